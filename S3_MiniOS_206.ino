@@ -11,7 +11,7 @@
  *
  *  FIX 1: SINGLE LVGL THREAD (NON-NEGOTIABLE)
  *   - Created dedicated ui_task for ALL LVGL operations
- *   - All LVGL calls now routed through ui_event system
+ *   - All LVGL calls now routed through the UI event queue
  *   - No more LVGL calls from touch callbacks, ISRs, or timers
  *
  *  FIX 2: SAFE NAVIGATION SYSTEM (NO FREEZES)
@@ -113,6 +113,12 @@
 #include <Arduino.h>
 #include "pin_config.h"
 #include <esp_task_wdt.h>  // FIX 7: Watchdog support
+#include <atomic>
+#include "mbedtls/version.h"
+#include "mbedtls/sha256.h"
+#include <Update.h>
+#include "esp_rom_crc.h"
+#include "esp_sntp.h"
 
 // Fix macro conflict
 #ifdef PCF85063_SLAVE_ADDRESS
@@ -148,6 +154,29 @@
   #endif
 #endif
 
+// Background tasks and FLB frames share the port with loop(). Each goes out
+// as a single write under serialMutex, so a log line from another task can
+// never land inside a binary frame.
+static SemaphoreHandle_t serialMutex = NULL;   // Created in setup()
+
+static void serialWrite(const uint8_t *data, size_t len) {
+    if (serialMutex != NULL) xSemaphoreTake(serialMutex, portMAX_DELAY);
+    USBSerial.write(data, len);
+    if (serialMutex != NULL) xSemaphoreGive(serialMutex);
+}
+
+// printf for tasks other than loop(); lines longer than the buffer are cut
+static void serialLogf(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+static void serialLogf(const char *fmt, ...) {
+    char buf[256];
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+    if (n <= 0) return;
+    serialWrite((const uint8_t *)buf, n < (int)sizeof(buf) ? n : sizeof(buf) - 1);
+}
+
 //  WIDGET OS - VERSION & DEVICE CONFIGURATION
 
 #define WIDGET_OS_NAME      "Widget OS"
@@ -173,16 +202,148 @@ enum UIEventType {
     UI_EVENT_SCREEN_OFF,
     UI_EVENT_REFRESH,
     UI_EVENT_LOW_BATTERY,
-    UI_EVENT_SHUTDOWN
+    UI_EVENT_SHUTDOWN,
+    UI_EVENT_NEXT_CATEGORY,     // Boot button short press
+    UI_EVENT_PROBE,             // Queue self-test, ignored by the handler
+    UI_EVENT_BENCHMARK,         // Run the card benchmark inside ui_task
+    UI_EVENT_FACE_CHANGED       // selectFace() loaded a new watch face
 };
 
-// Thread-safe event queue
-volatile UIEventType ui_event = UI_EVENT_NONE;
-volatile int ui_event_param1 = 0;  // For tap X coordinate
-volatile int ui_event_param2 = 0;  // For tap Y coordinate
-
 // UI Task handle
 TaskHandle_t ui_task_handle = NULL;
+#define UI_TASK_MAX_IDLE_MS 30      // Cap on ui_task sleep so touch keeps being polled
+
+// ═══════════════════════════════════════════════════════════════════════════
+//  UI EVENT QUEUE - Lock-free, multi-producer / single-consumer (ui_task)
+//  Input events (swipes, taps, buttons, screen on/off) go through a bounded
+//  ring with per-slot sequence numbers, so producers on either core never
+//  overwrite each other and params can't tear. REFRESH is not queued: it is
+//  a single pending flag, so any number of refresh requests coalesce into
+//  one, and ui_task always drains input before it refreshes.
+// ═══════════════════════════════════════════════════════════════════════════
+
+#define UI_EVENT_QUEUE_SIZE 32      // Must be a power of two
+#define UI_LATENCY_WINDOW   128     // Recent samples kept for p50/p99
+
+struct UIEvent {
+    UIEventType type;
+    int param1;                     // Tap X coordinate
+    int param2;                     // Tap Y coordinate
+    uint32_t postedUs;              // Enqueue timestamp (micros)
+};
+
+struct UIEventSlot {
+    std::atomic<uint32_t> seq;
+    UIEvent event;
+};
+
+static UIEventSlot ui_event_slots[UI_EVENT_QUEUE_SIZE];
+static std::atomic<uint32_t> ui_event_head(0);     // Next slot producers claim
+static uint32_t ui_event_tail = 0;                  // Next slot ui_task reads
+
+static std::atomic<bool> ui_refresh_pending(false);
+static std::atomic<uint32_t> ui_refresh_posted_us(0);
+
+struct UIQueueStats {
+    std::atomic<uint32_t> posted;       // Input events accepted
+    std::atomic<uint32_t> overflows;    // Input events rejected (queue full)
+    std::atomic<uint32_t> refreshPosted;
+    std::atomic<uint32_t> refreshCoalesced;
+    uint32_t handled;                   // Input events handled (ui_task only)
+    uint32_t refreshHandled;
+    uint32_t maxDepth;
+};
+
+UIQueueStats uiQueueStats;
+
+// Latency samples, written by ui_task only
+static uint32_t uiInputLatencyUs[UI_LATENCY_WINDOW];
+static uint32_t uiRefreshLatencyUs[UI_LATENCY_WINDOW];
+static uint32_t uiInputLatencyCount = 0;
+static uint32_t uiRefreshLatencyCount = 0;
+volatile uint32_t uiStressProbesHandled = 0;
+
+void ui_event_queue_init() {
+    for (uint32_t i = 0; i < UI_EVENT_QUEUE_SIZE; i++) {
+        ui_event_slots[i].seq.store(i, std::memory_order_relaxed);
+    }
+    ui_event_head.store(0, std::memory_order_relaxed);
+    ui_event_tail = 0;
+}
+
+static void ui_task_wake() {
+    if (ui_task_handle != NULL && xTaskGetCurrentTaskHandle() != ui_task_handle) {
+        xTaskNotifyGive(ui_task_handle);
+    }
+}
+
+// Post an event from any task. Returns false (and counts it) if the queue is full.
+bool ui_post_event(UIEventType type, int param1 = 0, int param2 = 0);
+
+bool ui_post_event(UIEventType type, int param1, int param2) {
+    uint32_t now = micros();
+
+    if (type == UI_EVENT_REFRESH) {
+        uiQueueStats.refreshPosted.fetch_add(1, std::memory_order_relaxed);
+        if (ui_refresh_pending.load(std::memory_order_acquire)) {
+            uiQueueStats.refreshCoalesced.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        ui_refresh_posted_us.store(now, std::memory_order_relaxed);
+        ui_refresh_pending.store(true, std::memory_order_release);
+        ui_task_wake();
+        return true;
+    }
+
+    uint32_t pos = ui_event_head.load(std::memory_order_relaxed);
+    while (true) {
+        UIEventSlot &slot = ui_event_slots[pos & (UI_EVENT_QUEUE_SIZE - 1)];
+        uint32_t seq = slot.seq.load(std::memory_order_acquire);
+        int32_t diff = (int32_t)(seq - pos);
+        if (diff == 0) {
+            // Slot free for this lap - claim it
+            if (ui_event_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                slot.event.type = type;
+                slot.event.param1 = param1;
+                slot.event.param2 = param2;
+                slot.event.postedUs = now;
+                slot.seq.store(pos + 1, std::memory_order_release);
+                break;
+            }
+        } else if (diff < 0) {
+            // Consumer hasn't freed this slot yet
+            uiQueueStats.overflows.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            pos = ui_event_head.load(std::memory_order_relaxed);
+        }
+    }
+
+    uiQueueStats.posted.fetch_add(1, std::memory_order_relaxed);
+    ui_task_wake();
+    return true;
+}
+
+// ui_task only
+static bool ui_pop_event(UIEvent &out) {
+    UIEventSlot &slot = ui_event_slots[ui_event_tail & (UI_EVENT_QUEUE_SIZE - 1)];
+    uint32_t seq = slot.seq.load(std::memory_order_acquire);
+    if ((int32_t)(seq - (ui_event_tail + 1)) < 0) return false;
+
+    out = slot.event;
+    slot.seq.store(ui_event_tail + UI_EVENT_QUEUE_SIZE, std::memory_order_release);
+    ui_event_tail++;
+    return true;
+}
+
+static uint32_t ui_event_queue_depth() {
+    return ui_event_head.load(std::memory_order_relaxed) - ui_event_tail;
+}
+
+static void ui_record_latency(uint32_t *window, uint32_t &count, uint32_t postedUs) {
+    window[count % UI_LATENCY_WINDOW] = micros() - postedUs;
+    count++;
+}
 
 // FIX 6: Display activity tracking
 volatile uint32_t last_ui_activity = 0;
@@ -213,6 +374,7 @@ void ui_activity_ping() {
 #define SD_MUSIC_PATH           "/WATCH/MUSIC"
 #define SD_CACHE_PATH           "/WATCH/CACHE"
 #define SD_CACHE_TEMP_PATH      "/WATCH/CACHE/temp"
+#define SD_NET_CACHE_PATH       "/WATCH/CACHE/net"
 #define SD_UPDATE_PATH          "/WATCH/UPDATE"
 #define SD_WIFI_PATH            "/WATCH/wifi"
 #define SD_BACKUP_PATH          "/WATCH/BACKUPS"
@@ -264,6 +426,37 @@ unsigned long lastAutoBackup = 0;
 unsigned long lastBackupTime = 0;
 int totalBackups = 0;
 
+// Deduplicating snapshot store (see BACKUP ENGINE)
+#define SD_BACKUP_BLOBS_PATH     "/WATCH/BACKUPS/blobs"
+#define SD_BACKUP_SNAPSHOTS_PATH "/WATCH/BACKUPS/snapshots"
+#define BACKUP_MANIFEST_MAGIC    "# Widget OS backup manifest v1"
+#define BACKUP_ARTIFACT_USER     "@user_data"      // Generated, not a file on the card
+#define BACKUP_ARTIFACT_COMPASS  "@compass"
+#define BACKUP_CHUNK_SIZE        4096              // Whole sectors per SD transfer
+#define BACKUP_MAX_ARTIFACTS     2304              // face.json + one asset for each indexed face, plus config
+#define BACKUP_MAX_SNAPSHOTS     64                // Manifests scanned per retention pass
+#define BACKUP_RETAIN_AUTO       7                 // A week of daily auto backups
+#define BACKUP_RETAIN_MANUAL     10
+#define BACKUP_RESTORE_WAIT_MS   10000
+
+struct BackupStats {
+    std::atomic<uint8_t> pending;   // Queued or running; createBackup() returns before the job ends
+    bool lastOk;
+    uint32_t runs;
+    uint32_t failures;
+    uint32_t lastMs;
+    uint32_t lastBytesRead;
+    uint32_t lastBytesWritten;      // New blobs + manifest
+    uint16_t lastArtifacts;
+    uint16_t lastSkipped;           // Artifacts that could not be read or stored
+    uint16_t lastTruncated;         // Artifacts beyond BACKUP_MAX_ARTIFACTS
+    uint16_t lastBlobsWritten;
+    uint16_t lastBlobsReused;
+    uint16_t lastPruned;            // Snapshots dropped by retention
+    uint16_t lastBlobsFreed;
+    char lastName[40];
+};
+
 // SD Card health tracking (Fusion Labs compatible)
 struct SDCardHealth {
     uint64_t totalBytes;
@@ -287,11 +480,42 @@ SDCardHealth sdHealth = {0, 0, 0, 0.0, false, false, "", 0, 0};
 #define WEB_SERIAL_BUFFER_SIZE 4096
 char webSerialBuffer[WEB_SERIAL_BUFFER_SIZE];
 int webSerialBufferIndex = 0;
+bool webSerialOverflow = false;     // Current line exceeded the buffer; dropped at '\n'
 bool receivingFirmware = false;
 bool receivingFace = false;
+bool receivingImuTrace = false;
 String currentFaceId = "";
 String webSerialCommand = "";
 
+// Binary frame protocol (see FUSION LABS BINARY FRAMES)
+#define FLB_VERSION             1
+#define FLB_SYNC0               0xA5
+#define FLB_SYNC1               0x5A
+#define FLB_HEADER_SIZE         8
+#define FLB_MAX_PAYLOAD         2048
+#define FLB_TX_MAX_PAYLOAD      32      // Device frames: status + a short reply
+#define FLB_REPLY_MAX           (FLB_TX_MAX_PAYLOAD - 1)   // Handler reply bytes after the status
+#define FLB_WINDOW              4       // Host-side frames in flight
+#define FLB_ACK_EVERY           2       // Data frames per ack
+#define FLB_RX_BUFFER_SIZE      12288   // >= FLB_WINDOW full frames
+#define FLB_STAGE_SIZE          4096    // SD write block for face payloads
+#define FLB_FRAME_TIMEOUT_MS    500
+#define FLB_FLAG_ACK_REQ        0x01
+#define FLB_REPLY               0x80    // OR'd into the type of a command's reply
+
+// Frame types
+#define FLB_HELLO               0x01
+#define FLB_TEXT                0x02    // Payload is a text command line
+#define FLB_FACE_BEGIN          0x10
+#define FLB_FACE_DATA           0x11
+#define FLB_FACE_END            0x12
+#define FLB_FW_BEGIN            0x20
+#define FLB_FW_DATA             0x21
+#define FLB_FW_END              0x22
+#define FLB_ABORT               0x30
+#define FLB_ACK                 0x7E
+#define FLB_NAK                 0x7F
+
 // Protocol commands from Fusion Labs web interface
 // WIDGET_PING         - Check connection
 // WIDGET_STATUS       - Get device status
@@ -299,11 +523,23 @@ String webSerialCommand = "";
 // WIDGET_WRITE_CONFIG - Write config.txt
 // WIDGET_BACKUP       - Trigger manual backup
 // WIDGET_RESTORE      - Restore from backup
+// WIDGET_BACKUP_STATS - Last snapshot's bytes written, time and dedup counts
 // WIDGET_SD_HEALTH    - Get SD card health
 // WIDGET_WRITE_FACE   - Install watch face
-// WIDGET_SET_FACE     - Set active watch face
+// WIDGET_SET_FACE     - Set active watch face (":default" for the built-in clock, ":imported/<id>" for an imported face)
 // WIDGET_LIST_FACES   - List installed faces
-// WIDGET_FLASH_FW     - Receive firmware update
+// WIDGET_RESCAN_FACES - Rebuild the face index after faces were copied to or deleted from the card
+// WIDGET_FACE_STATS   - Face index load time, compile counts and per-tick render cost
+// WIDGET_FLASH_FW     - Receive firmware update (binary FLB_FW_* frames)
+// WIDGET_PROTO_STATS  - Binary frame counters and last transfer throughput
+// WIDGET_NET_STATS    - Boot milestones and per-endpoint fetch/cache counters
+// WIDGET_NET_REFRESH  - Refetch every network endpoint now, ignoring TTLs
+// WIDGET_CARD_STATS   - Per-card rebuild/update/flush counters
+// WIDGET_UI_QUEUE_STATS  - UI event queue counters and p50/p99 latency
+// WIDGET_UI_QUEUE_STRESS - Multi-core UI event queue self-test
+// WIDGET_BENCHMARK    - Per-card build/frame/flush/heap benchmark
+// WIDGET_IMU_TRACE    - Replay a CSV accel/gyro trace through fusion + steps
+// WIDGET_DISPLAY_STATS - Flush pipeline counters (merges, bus time, overlap)
 
 // 
 //  WIFI & API CONFIGURATION
@@ -321,6 +557,14 @@ String webSerialCommand = "";
 #define WIFI_RECONNECT_INTERVAL_MS 60000  // Check connection every 60 seconds
 #define MIN_RSSI_THRESHOLD -85        // Minimum signal strength for open networks
 
+// Network service (see NETWORK SERVICE)
+enum NetEndpointId { NET_LOCATION, NET_WEATHER, NET_SUN, NET_CURRENCY, NET_EP_COUNT };
+#define NET_EP_BIT(i)        (1 << (i))
+#define NET_POLL_MS          15000      // net_task wakes this often to check TTLs
+#define NET_RETRY_MS         120000     // Back-off after a failed fetch
+#define NET_HTTP_TIMEOUT_MS  5000
+#define NET_MIN_VALID_EPOCH  1735689600 // 2025-01-01: below this the clock is not set yet
+
 struct WiFiNetwork {
     char ssid[64];
     char password[64];
@@ -358,6 +602,9 @@ const char* CURRENCY_API_KEY = "cur_live_ROqsDnwrNd40cRqegQakXb4pO6tQuihpU9OQr4N
 bool wifiConnected = false;
 bool wifiConfigFromSD = false;
 
+// Boot milestones (millis), reported by WIDGET_NET_STATS
+uint32_t bootFirstFrameMs = 0, bootWifiMs = 0, bootNtpMs = 0, bootCacheLoadUs = 0;
+
 // 
 //  BATTERY INTELLIGENCE CONFIGURATION
 // 
@@ -383,6 +630,39 @@ bool wifiConfigFromSD = false;
 //  LVGL CONFIGURATION
 // 
 #define LVGL_TICK_PERIOD_MS 2
+
+// Draw buffer strategy (build-time)
+#define DISP_BUF_INTERNAL_50    0   // 2 x 50 lines in internal DMA-capable RAM
+#define DISP_BUF_PSRAM_STRIPE   1   // 2 x DISP_STRIPE_LINES lines in PSRAM
+#define DISP_BUF_FULL_FRAME     2   // 2 x full frame in PSRAM
+#ifndef DISP_BUF_STRATEGY
+#define DISP_BUF_STRATEGY       DISP_BUF_PSRAM_STRIPE
+#endif
+#ifndef DISP_STRIPE_LINES
+#define DISP_STRIPE_LINES       50
+#endif
+
+// 1 = flush_cb queues the transfer to flush_task and returns immediately
+#ifndef DISP_ASYNC_FLUSH
+#define DISP_ASYNC_FLUSH        1
+#endif
+
+// Two dirty areas are merged if their bounding box wastes fewer pixels
+// than this (roughly the cost of one extra window set-up on the QSPI bus)
+#define DISP_MERGE_SLACK_PX     (LCD_WIDTH * 4)
+
+// LVGL has no public hook between invalidation and refresh, so the merge
+// wraps the private _lv_disp_refr_timer and edits lv_disp_t's inv_areas.
+// Only verified against LVGL 8.3.x; any other version gets LVGL's own joining.
+#if LVGL_VERSION_MAJOR == 8 && LVGL_VERSION_MINOR == 3
+#define DISP_MERGE_AREAS        1
+#else
+#define DISP_MERGE_AREAS        0
+#endif
+
+// Safety net only: flush_task always signals, this just bounds a lost wake-up
+#define DISP_WAIT_TIMEOUT_MS    20
+
 static lv_disp_draw_buf_t draw_buf;
 static lv_color_t *buf1 = NULL;
 static lv_color_t *buf2 = NULL;
@@ -423,6 +703,7 @@ enum Category {
 int currentCategory = CAT_CLOCK;
 int currentSubCard = 0;
 const int maxSubCards[] = {5, 3, 4, 3, 2, 2, 4, 3, 1, 2, 4, 1, 4, 2};  // CAT_STOCKS removed  // CAT_SYSTEM now has 4 (added SD Health)
+#define MAX_SUB_CARDS 5  // Largest entry in maxSubCards[]
 
 // Animation state
 bool isTransitioning = false;
@@ -577,6 +858,7 @@ lv_obj_t *shutdownProgressLabel = NULL;
 // Clock
 uint8_t clockHour = 10, clockMinute = 30, clockSecond = 0;
 uint8_t currentDay = 3;
+uint8_t currentWeekday = 0;     // 0 = Sunday, cached from the RTC once a second
 
 // Weather
 float weatherTemp = 24.0;
@@ -838,20 +1120,29 @@ bool sdWallpapersLoaded = false;
 
 // 
 //  WIDGET OS - FACE LOADING SYSTEM
+//  Installed faces are listed in FACE_INDEX_PATH (see WATCH FACE ENGINE)
 // 
-#define MAX_SD_FACES 20
+#define FACE_INDEX_PATH "/WATCH/FACES/index.bin"
+#define FACE_BLOB_NAME  "face.wfc"      // Compiled face, next to face.json
 
+// One index record, stored on SD as-is
 struct SDFace {
-    char folderPath[128];
+    char id[32];                // Folder name
     char name[32];
     char author[32];
     char version[16];
-    bool supportsCurrentScreen;
-    bool valid;
+    uint32_t blobSize;          // face.wfc bytes
+    uint32_t srcSize;           // face.json bytes it was compiled from
+    uint16_t elementCount;
+    uint8_t imported;           // In SD_FACES_IMPORTED_PATH rather than custom
+    uint8_t supportsCurrentScreen;
+    uint8_t reserved[4];
 };
+static_assert(sizeof(SDFace) == 128, "face index record layout");
 
-SDFace sdFaces[MAX_SD_FACES];
+SDFace *sdFaces = NULL;         // PSRAM, grows with the index
 int numSDFaces = 0;
+int sdFacesCapacity = 0;
 
 struct WallpaperTheme {
   const char* name;
@@ -876,15 +1167,23 @@ WallpaperTheme gradientWallpapers[] = {
 //  FUNCTION PROTOTYPES
 // 
 void navigateTo(int category, int subCard);
+void refreshCurrentCard();
 void handleSwipe(int dx, int dy);
 void handleTap(int x, int y);  // NEW: Separate tap handler
 void saveUserData();
 void loadUserData();
 void syncTimeNTP();
-void fetchWeatherData();
-void fetchLocationFromIP();
+void loadNetCache();
+void startNetworkService();
+void netRequestRefresh(uint8_t endpoints);
+void applyNetResults(bool notifyUi);
+void printNetStats();
 void updateSensorFusion();
 void calibrateCompass();
+void startSensorTask();
+void beginImuTraceReplay();
+void feedImuTraceLine(const String& line);
+void endImuTraceReplay();
 void displayWallpaperImage(lv_obj_t *parent, int wallpaperIndex);
 
 // Identity system functions
@@ -911,10 +1210,12 @@ void toggleBatterySaver();
 // SD Card Management & Backup System
 void initSDCardStructure();
 void updateSDCardHealth();
+void initBackupEngine();
 bool createBackup(bool isAuto);
 bool restoreFromBackup(const String& backupName);
 void checkAutoBackup();
 String listBackups();
+void printBackupStats();
 bool saveConfigToSD(const String& configData);
 String readConfigFromSD();
 
@@ -938,8 +1239,16 @@ void saveUserConfigToSD();
 bool loadWiFiConfigFromSD();
 const char* getSDCardStatusString();
 void listSDDirectory(const char* dirname, uint8_t levels);
-void scanSDFaces();
-void scanFacesInDirectory(const char* dirPath);
+void loadFaceIndex();
+void rebuildFaceIndex();
+bool faceIdValid(const char *faceId);
+bool installFace(const char *faceId);
+bool selectFace(const char *id, bool persist);
+void restoreSavedFace();
+void applyPendingFace();
+bool customFaceActive();
+void printFaceList();
+void printFaceStats();
 
 // Fusion Labs Web Serial Protocol
 void processWebSerialCommand(const String& cmd);
@@ -948,14 +1257,22 @@ void sendDeviceStatus();
 void sendSDHealth();
 void handleFaceInstall(const String& faceId, const String& faceData);
 void handleFirmwareChunk(const uint8_t* data, size_t len);
+void printProtocolStats();
+void printUIQueueStats();
+void startUIQueueStressTest();
+void runCardBenchmark();
 
 // Screen control
+void displaySetBrightness(uint8_t level);
+void displayWaitFlushDone();
+void printDisplayStats();
 void screenOff();
 void screenOnFunc();
 void shutdownDevice();
 
 // Card creators
 void createClockCard();
+void createCustomFaceCard();
 void createAnalogClockCard();
 void createWorldClockCard(int utcOffset, const char* country, const char* city);
 void createCompassCard();
@@ -996,6 +1313,17 @@ void createIdentityMainCard();
 void createIdentityGridCard();
 void createSDCardHealthCard();  // FIXED: Added missing function declaration
 
+// Card update hooks (in-place refresh, return false to force a rebuild)
+bool updateClockCard();
+bool updateAnalogClockCard();
+bool updateWorldClockCard();
+bool updateCompassCard();
+bool updateDinoCard();
+bool updateMusicCard();
+bool updateSandTimerCard();
+bool updateStopwatchCard();
+bool updateBreatheCard();
+
 // ═══════════════════════════════════════════════════════════════════════════
 //  FIX 2: SAFE NAVIGATION - Track current screen for safe switching
 // ═══════════════════════════════════════════════════════════════════════════
@@ -1011,16 +1339,203 @@ static void lvgl_tick_cb(void *arg) {
     lv_tick_inc(LVGL_TICK_PERIOD_MS);
 }
 
+// ═══════════════════════════════════════════════════════════════════════════
+//  DISPLAY FLUSH PIPELINE
+//  LVGL -> rounder (CO5300 2px alignment) -> dirty-area merge -> transport.
+//  With DISP_ASYNC_FLUSH the transport hands each area to flush_task on
+//  core 0 and returns, so LVGL renders into the second buffer while the
+//  first is still going out over QSPI. flush_ready comes from the task.
+// ═══════════════════════════════════════════════════════════════════════════
+
+// Running total of pixels pushed to the panel (read by card perf stats)
+volatile uint32_t flushedPixelCount = 0;
+
+struct DisplayStats {
+    uint32_t pushes;                // Areas handed to the transport
+    uint32_t merged;                // Dirty areas folded into a neighbour
+    volatile uint32_t transferUs;   // Time spent on the bus
+    uint32_t waitUs;                // Time LVGL spent blocked until a buffer was free
+};
+
+DisplayStats dispStats = {};
+
+// Everything that talks to the panel goes through this, so a different
+// bus (or a host-side mock) only has to implement these calls
+class DisplayTransport {
+public:
+    virtual ~DisplayTransport() {}
+    virtual void begin() {}
+    // Send one area. Must call lv_disp_flush_ready(drv) once pixels is free again.
+    virtual void push(lv_disp_drv_t *drv, const lv_area_t &area, uint16_t *pixels) = 0;
+    // Block until drv's draw buffer is released (LVGL wait_cb)
+    virtual void waitIdle(lv_disp_drv_t *drv) {}
+    virtual void setBrightness(uint8_t level) = 0;
+};
+
+// Transfer inside flush_cb (the original behaviour)
+class GfxBlockingTransport : public DisplayTransport {
+public:
+    void push(lv_disp_drv_t *drv, const lv_area_t &area, uint16_t *pixels) override {
+        uint32_t t = micros();
+        gfx->draw16bitRGBBitmap(area.x1, area.y1, pixels, lv_area_get_width(&area), lv_area_get_height(&area));
+        dispStats.transferUs += micros() - t;
+        lv_disp_flush_ready(drv);
+    }
+    void setBrightness(uint8_t level) override {
+        gfx->setBrightness(level);
+    }
+};
+
+// Queue the transfer to flush_task and return straight away
+class GfxTaskTransport : public DisplayTransport {
+    struct FlushJob {
+        lv_disp_drv_t *drv;
+        lv_area_t area;
+        uint16_t *pixels;
+    };
+
+    QueueHandle_t jobs = NULL;
+    SemaphoreHandle_t done = NULL;      // Given when a flush completes while LVGL waits
+    std::atomic<bool> waiting{false};
+    SemaphoreHandle_t busLock = NULL;   // Brightness commands share the QSPI bus
+
+    static void taskEntry(void *arg) {
+        ((GfxTaskTransport *)arg)->run();
+    }
+
+    void run() {
+        FlushJob job;
+        while (true) {
+            if (xQueueReceive(jobs, &job, portMAX_DELAY) != pdTRUE) continue;
+            xSemaphoreTake(busLock, portMAX_DELAY);
+            uint32_t t = micros();
+            gfx->draw16bitRGBBitmap(job.area.x1, job.area.y1, job.pixels,
+                                    lv_area_get_width(&job.area), lv_area_get_height(&job.area));
+            dispStats.transferUs += micros() - t;
+            xSemaphoreGive(busLock);
+            lv_disp_flush_ready(job.drv);
+            if (waiting.load()) xSemaphoreGive(done);
+        }
+    }
+
+public:
+    void begin() override {
+        jobs = xQueueCreate(2, sizeof(FlushJob));   // One per draw buffer
+        done = xSemaphoreCreateBinary();
+        busLock = xSemaphoreCreateMutex();
+        xTaskCreatePinnedToCore(taskEntry, "flush_task", 4096, this, 4, NULL, 0);
+    }
+
+    void push(lv_disp_drv_t *drv, const lv_area_t &area, uint16_t *pixels) override {
+        FlushJob job = {drv, area, pixels};
+        xQueueSend(jobs, &job, portMAX_DELAY);
+    }
+
+    void waitIdle(lv_disp_drv_t *drv) override {
+        if (!drv->draw_buf->flushing) return;
+        uint32_t t = micros();
+        // Re-check the real condition: a give left over from a flush that
+        // raced the previous wait only costs one extra pass
+        waiting = true;
+        while (drv->draw_buf->flushing) {
+            xSemaphoreTake(done, pdMS_TO_TICKS(DISP_WAIT_TIMEOUT_MS));
+        }
+        waiting = false;
+        dispStats.waitUs += micros() - t;
+    }
+
+    void setBrightness(uint8_t level) override {
+        if (busLock == NULL) {
+            gfx->setBrightness(level);
+            return;
+        }
+        xSemaphoreTake(busLock, portMAX_DELAY);
+        gfx->setBrightness(level);
+        xSemaphoreGive(busLock);
+    }
+};
+
+#if DISP_ASYNC_FLUSH
+static GfxTaskTransport dispTransportImpl;
+#else
+static GfxBlockingTransport dispTransportImpl;
+#endif
+DisplayTransport *displayTransport = &dispTransportImpl;
+
+void displaySetBrightness(uint8_t level) {
+    displayTransport->setBrightness(level);
+}
+
 void my_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p) {
-    uint32_t w = (area->x2 - area->x1 + 1);
-    uint32_t h = (area->y2 - area->y1 + 1);
-    gfx->draw16bitRGBBitmap(area->x1, area->y1, (uint16_t *)&color_p->full, w, h);
-    lv_disp_flush_ready(disp);
+    flushedPixelCount += lv_area_get_size(area);
+    dispStats.pushes++;
+    if (bootFirstFrameMs == 0 && lv_disp_flush_is_last(disp)) bootFirstFrameMs = millis();
+    displayTransport->push(disp, *area, (uint16_t *)&color_p->full);
+}
+
+void my_disp_wait(lv_disp_drv_t *disp) {
+    displayTransport->waitIdle(disp);
+}
+
+// CO5300 column/row windows must start on an even address and span an even count
+void my_disp_rounder(lv_disp_drv_t *disp, lv_area_t *area) {
+    area->x1 &= ~1;
+    area->y1 &= ~1;
+    area->x2 |= 1;
+    area->y2 |= 1;
+}
+
+#if DISP_MERGE_AREAS
+// LVGL only joins areas that overlap and shrink; also merge near neighbours
+// (e.g. HH:MM and :SS labels) when the bounding box costs little extra
+static void mergeAdjacentDirtyAreas(lv_disp_t *disp) {
+    for (uint16_t i = 0; i < disp->inv_p; i++) {
+        if (disp->inv_area_joined[i]) continue;
+        for (uint16_t j = 0; j < disp->inv_p; j++) {
+            if (i == j || disp->inv_area_joined[j]) continue;
+
+            lv_area_t merged;
+            _lv_area_join(&merged, &disp->inv_areas[i], &disp->inv_areas[j]);
+            uint32_t separate = lv_area_get_size(&disp->inv_areas[i]) + lv_area_get_size(&disp->inv_areas[j]);
+            if (lv_area_get_size(&merged) <= separate + DISP_MERGE_SLACK_PX) {
+                lv_area_copy(&disp->inv_areas[i], &merged);
+                disp->inv_area_joined[j] = 1;
+                dispStats.merged++;
+            }
+        }
+    }
+}
+
+static void disp_refr_timer_cb(lv_timer_t *timer) {
+    lv_disp_t *disp = (lv_disp_t *)timer->user_data;
+    if (disp != NULL) mergeAdjacentDirtyAreas(disp);
+    _lv_disp_refr_timer(timer);
+}
+#endif
+
+// Block until the transport has released both draw buffers
+void displayWaitFlushDone() {
+    lv_disp_t *disp = lv_disp_get_default();
+    if (disp == NULL) return;
+    displayTransport->waitIdle(disp->driver);
+}
+
+void printDisplayStats() {
+    uint32_t transferUs = dispStats.transferUs;
+    uint32_t overlapPct = transferUs > dispStats.waitUs ? 100 - (uint32_t)((uint64_t)dispStats.waitUs * 100 / transferUs) : 0;
+    USBSerial.printf("{\"type\":\"WIDGET_DISPLAY_STATS_RESPONSE\",\"async\":%s,\"buf_lines\":%lu,"
+                     "\"pushes\":%lu,\"pixels\":%lu,\"merged\":%lu,\"transfer_us\":%lu,"
+                     "\"wait_us\":%lu,\"overlap_pct\":%lu}\n",
+                     DISP_ASYNC_FLUSH ? "true" : "false",
+                     (unsigned long)(draw_buf.size / LCD_WIDTH),
+                     (unsigned long)dispStats.pushes, (unsigned long)flushedPixelCount,
+                     (unsigned long)dispStats.merged, (unsigned long)transferUs,
+                     (unsigned long)dispStats.waitUs, (unsigned long)overlapPct);
 }
 
 // ═══════════════════════════════════════════════════════════════════════════
 //  FIX 4: TOUCH DRIVER - NO UI LOGIC IN CALLBACK
-//  Only returns coordinates. Navigation handled via ui_event flags.
+//  Only returns coordinates. Navigation handled via the UI event queue.
 // ═══════════════════════════════════════════════════════════════════════════
 
 volatile bool touch_interrupt_flag = false;
@@ -1071,22 +1586,20 @@ void my_touchpad_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data) {
                 if (abs(dx) > SWIPE_THRESHOLD_MIN && abs(dx) > abs(dy)) {
                     // Horizontal swipe
                     if (dx > 0) {
-                        ui_event = UI_EVENT_NAV_LEFT;  // Swipe right = go left
+                        ui_post_event(UI_EVENT_NAV_LEFT);  // Swipe right = go left
                     } else {
-                        ui_event = UI_EVENT_NAV_RIGHT; // Swipe left = go right
+                        ui_post_event(UI_EVENT_NAV_RIGHT); // Swipe left = go right
                     }
                 } else if (abs(dy) > SWIPE_THRESHOLD_MIN && abs(dy) > abs(dx)) {
                     // Vertical swipe
                     if (dy > 0) {
-                        ui_event = UI_EVENT_NAV_UP;    // Swipe down = go up
+                        ui_post_event(UI_EVENT_NAV_UP);    // Swipe down = go up
                     } else {
-                        ui_event = UI_EVENT_NAV_DOWN;  // Swipe up = go down
+                        ui_post_event(UI_EVENT_NAV_DOWN);  // Swipe up = go down
                     }
                 } else if (abs(dx) < TAP_THRESHOLD && abs(dy) < TAP_THRESHOLD) {
                     // Tap
-                    ui_event = UI_EVENT_TAP;
-                    ui_event_param1 = touchCurrentX;
-                    ui_event_param2 = touchCurrentY;
+                    ui_post_event(UI_EVENT_TAP, touchCurrentX, touchCurrentY);
                 }
             }
         }
@@ -1100,7 +1613,7 @@ void screenOff() {
     screenOffStartMs = millis();
 
     screenOn = false;
-    gfx->setBrightness(0);
+    displaySetBrightness(0);
 }
 
 void screenOnFunc() {
@@ -1111,7 +1624,7 @@ void screenOnFunc() {
 
     screenOn = true;
     lastActivityMs = millis();
-    gfx->setBrightness(batterySaverMode ? 100 : userData.brightness);
+    displaySetBrightness(batterySaverMode ? 100 : userData.brightness);
     navigateTo(currentCategory, currentSubCard);
 }
 
@@ -1165,7 +1678,7 @@ void shutdownDevice() {
     lv_task_handler();
     delay(1000);
 
-    gfx->setBrightness(0);
+    displaySetBrightness(0);
     if (hasPMU) power.shutdown();
     esp_deep_sleep_start();
 }
@@ -1437,7 +1950,7 @@ void handleTap(int x, int y) {
                 lapCount = 0;
             }
         }
-        navigateTo(currentCategory, currentSubCard);
+        refreshCurrentCard();
     }
     else if (currentCategory == CAT_TOOLS && currentSubCard == 3) {
         // Daily Challenge - check which option was tapped
@@ -1667,7 +2180,7 @@ void toggleBatterySaver() {
     batterySaverMode = !batterySaverMode;
     batterySaverAutoEnabled = false;
 
-    gfx->setBrightness(batterySaverMode ? 100 : userData.brightness);
+    displaySetBrightness(batterySaverMode ? 100 : userData.brightness);
 }
 
 // 
@@ -1883,7 +2396,7 @@ void connectWiFi() {
             delay(500);
             attempts++;
         }
-        USBSerial.println();
+        serialLogf("\n");
     
         if (WiFi.status() == WL_CONNECTED) {
             wifiConnected = true;
@@ -1924,7 +2437,7 @@ void scanWiFiNetworks() {
         wifi_auth_mode_t encType = WiFi.encryptionType(i);
         bool isOpen = (encType == WIFI_AUTH_OPEN);
     
-        USBSerial.printf("  [%d] %s (RSSI: %d dBm, %s)\n", 
+        serialLogf("  [%d] %s (RSSI: %d dBm, %s)\n", 
             i + 1, ssid.c_str(), rssi, isOpen ? "OPEN" : "SECURED");
     
         // Track open networks with good signal
@@ -1985,7 +2498,7 @@ bool connectToKnownNetworks() {
             continue;
         }
     
-        USBSerial.printf("[WIFI] Trying known network %d/%d: %s (RSSI: %d)\n", 
+        serialLogf("[WIFI] Trying known network %d/%d: %s (RSSI: %d)\n", 
             i + 1, numWifiNetworks, wifiNetworks[i].ssid, wifiNetworks[i].rssi);
     
         WiFi.begin(wifiNetworks[i].ssid, wifiNetworks[i].password);
@@ -1994,7 +2507,7 @@ bool connectToKnownNetworks() {
         while (WiFi.status() != WL_CONNECTED && (millis() - startTime) < WIFI_CONNECT_TIMEOUT_MS) {
             delay(250);
         }
-        USBSerial.println();
+        serialLogf("\n");
     
         if (WiFi.status() == WL_CONNECTED) {
             wifiConnected = true;
@@ -2021,7 +2534,7 @@ bool connectToOpenNetworks() {
     for (int i = 0; i < numOpenNetworks; i++) {
         if (!openNetworks[i].valid) continue;
     
-        USBSerial.printf("[WIFI] Trying open network %d/%d: %s (RSSI: %d dBm)\n", 
+        serialLogf("[WIFI] Trying open network %d/%d: %s (RSSI: %d dBm)\n", 
             i + 1, numOpenNetworks, openNetworks[i].ssid, openNetworks[i].rssi);
     
         WiFi.begin(openNetworks[i].ssid);  // No password for open networks
@@ -2030,7 +2543,7 @@ bool connectToOpenNetworks() {
         while (WiFi.status() != WL_CONNECTED && (millis() - startTime) < WIFI_CONNECT_TIMEOUT_MS) {
             delay(250);
         }
-        USBSerial.println();
+        serialLogf("\n");
     
         if (WiFi.status() == WL_CONNECTED) {
             wifiConnected = true;
@@ -2075,10 +2588,11 @@ void smartWiFiConnect() {
     connectedToOpenNetwork = false;
 }
 
-// Check WiFi status and reconnect if needed (called from loop)
-void checkWiFiConnection() {
+// Check WiFi status and reconnect if needed (called from net_task).
+// Returns true when the connection came back, so the caller can resync.
+bool checkWiFiConnection() {
     if (millis() - lastWiFiCheck < WIFI_RECONNECT_INTERVAL_MS) {
-        return;  // Not time to check yet
+        return false;  // Not time to check yet
     }
     lastWiFiCheck = millis();
 
@@ -2087,8 +2601,9 @@ void checkWiFiConnection() {
         if (!wifiConnected) {
             // We reconnected somehow
             wifiConnected = true;
+            return true;
         }
-        return;  // All good
+        return false;  // All good
     }
 
     // Connection lost - attempt reconnect
@@ -2100,120 +2615,651 @@ void checkWiFiConnection() {
 
     // Try to reconnect
     smartWiFiConnect();
+    return wifiConnected;
+}
+
+// 
+//  NETWORK SERVICE
+//  net_task (core 0, low priority) owns WiFi, NTP and every HTTP fetch, so
+//  loop() never waits on the network. Each endpoint's response is parsed
+//  straight off the socket through an ArduinoJson filter (only the fields we
+//  use are kept) and the filtered body is cached on SD with its fetch time.
+//  At boot the cache is loaded before the UI starts, so the last good
+//  weather, sun times and rates show immediately, and an endpoint is only
+//  refetched once its TTL has passed. Parsed values are staged in
+//  netPending; loop() copies them into the globals the cards read.
+// 
+struct NetResults {
+    uint8_t dirty;              // NET_EP_BIT(i) set when endpoint i has new values
+    float weatherTemp, weatherHigh, weatherLow;
+    char weatherDesc[24];
+    char city[64];
+    char country[8];
+    char sunrise[6], sunset[6];
+    float usdRate, audRate;
+};
 
-    // If reconnected, sync time and update location
-    if (wifiConnected) {
-        configTime(gmtOffsetSec, DAYLIGHT_OFFSET_SEC, NTP_SERVER);
-        // Auto-detect location based on IP and update weather
-        fetchLocationFromIP();
-    }
+struct NetEndpointStats {
+    uint32_t fetches;
+    uint32_t failures;
+    uint32_t lastLatencyMs;     // Request start to parsed body
+    uint32_t maxLatencyMs;
+    int16_t lastCode;
+    bool fromCache;             // Current values came from the SD cache
+};
+
+struct NetEndpoint {
+    const char *name;           // Cache file name and log tag
+    uint32_t ttlSec;
+    size_t docSize;
+    void (*buildUrl)(char *url, size_t len);
+    void (*buildFilter)(JsonDocument &filter);
+    bool (*parse)(JsonVariantConst body);
+};
+
+static NetResults netPending = {};
+static portMUX_TYPE netLock = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t net_task_handle = NULL;
+static std::atomic<uint8_t> netForce(0);        // NET_EP_BIT mask to fetch regardless of TTL
+static std::atomic<bool> netTimeSynced(false);  // Set by SNTP, consumed by loop()
+static char netCity[64] = "", netCountry[8] = "";  // net_task's copy of the location
+static time_t netFetchedAt[NET_EP_COUNT] = {};   // Epoch of the cached/fetched body
+static uint32_t netLastAttemptMs[NET_EP_COUNT] = {};
+static bool netAttempted[NET_EP_COUNT] = {};
+NetEndpointStats netStats[NET_EP_COUNT] = {};
+
+static void netUrlLocation(char *url, size_t len) {
+    // ip-api.com geolocation (no API key needed)
+    snprintf(url, len, "http://ip-api.com/json/?fields=city,countryCode,status");
+}
+
+static void netFilterLocation(JsonDocument &filter) {
+    filter["status"] = true;
+    filter["city"] = true;
+    filter["countryCode"] = true;
+}
+
+static bool netParseLocation(JsonVariantConst body) {
+    const char* city = body["city"];
+    const char* country = body["countryCode"];
+    if (body["status"] != "success" || !city || !strlen(city)) return false;
+
+    strncpy(netCity, city, sizeof(netCity) - 1);
+    if (country && strlen(country) > 0) strncpy(netCountry, country, sizeof(netCountry) - 1);
+    portENTER_CRITICAL(&netLock);
+    strncpy(netPending.city, netCity, sizeof(netPending.city) - 1);
+    strncpy(netPending.country, netCountry, sizeof(netPending.country) - 1);
+    netPending.dirty |= NET_EP_BIT(NET_LOCATION);
+    portEXIT_CRITICAL(&netLock);
+    return true;
+}
+
+static void netUrlWeather(char *url, size_t len) {
+    snprintf(url, len, "http://api.openweathermap.org/data/2.5/weather?q=%s,%s&appid=%s&units=metric",
+             netCity, netCountry, OPENWEATHER_API);
+}
+
+static void netFilterWeather(JsonDocument &filter) {
+    filter["main"]["temp"] = true;
+    filter["main"]["temp_max"] = true;
+    filter["main"]["temp_min"] = true;
+    filter["weather"][0]["main"] = true;
+}
+
+static bool netParseWeather(JsonVariantConst body) {
+    if (!body["main"]["temp"].is<float>()) return false;
+    const char *desc = body["weather"][0]["main"];
+
+    portENTER_CRITICAL(&netLock);
+    netPending.weatherTemp = body["main"]["temp"];
+    netPending.weatherHigh = body["main"]["temp_max"];
+    netPending.weatherLow = body["main"]["temp_min"];
+    if (desc) strncpy(netPending.weatherDesc, desc, sizeof(netPending.weatherDesc) - 1);
+    netPending.dirty |= NET_EP_BIT(NET_WEATHER);
+    portEXIT_CRITICAL(&netLock);
+    return true;
+}
+
+static void netUrlSun(char *url, size_t len) {
+    // Use Perth, Australia coordinates (from weatherCity)
+    snprintf(url, len, "https://api.sunrise-sunset.org/json?lat=%.4f&lng=%.4f&formatted=0",
+             -31.9505, 115.8605);
+}
+
+static void netFilterSun(JsonDocument &filter) {
+    filter["results"]["sunrise"] = true;
+    filter["results"]["sunset"] = true;
+}
+
+static bool netParseSun(JsonVariantConst body) {
+    const char* sunrise = body["results"]["sunrise"];
+    const char* sunset = body["results"]["sunset"];
+    if (!sunrise || !sunset || strlen(sunrise) < 16 || strlen(sunset) < 16) return false;
+
+    // ISO 8601 UTC "2025-01-27T21:39:15+00:00" -> local HH:MM
+    int sunriseHour = (atoi(sunrise + 11) + gmtOffsetSec / 3600 + 24) % 24;
+    int sunsetHour = (atoi(sunset + 11) + gmtOffsetSec / 3600 + 24) % 24;
+
+    portENTER_CRITICAL(&netLock);
+    snprintf(netPending.sunrise, sizeof(netPending.sunrise), "%02d:%.2s", sunriseHour, sunrise + 14);
+    snprintf(netPending.sunset, sizeof(netPending.sunset), "%02d:%.2s", sunsetHour, sunset + 14);
+    netPending.dirty |= NET_EP_BIT(NET_SUN);
+    portEXIT_CRITICAL(&netLock);
+    return true;
+}
+
+static void netUrlCurrency(char *url, size_t len) {
+    snprintf(url, len, "https://api.currencyapi.com/v3/latest?apikey=%s&base_currency=%s&currencies=USD,AUD",
+             CURRENCY_API_KEY, currencyData.sourceCurrency);
+}
+
+static void netFilterCurrency(JsonDocument &filter) {
+    filter["data"]["USD"]["value"] = true;
+    filter["data"]["AUD"]["value"] = true;
 }
 
-void fetchWeatherData() {
-    if (!wifiConnected) return;
+static bool netParseCurrency(JsonVariantConst body) {
+    if (!body["data"]["USD"]["value"].is<float>()) return false;
 
+    portENTER_CRITICAL(&netLock);
+    netPending.usdRate = body["data"]["USD"]["value"];
+    netPending.audRate = body["data"]["AUD"]["value"];
+    netPending.dirty |= NET_EP_BIT(NET_CURRENCY);
+    portEXIT_CRITICAL(&netLock);
+    return true;
+}
+
+// Indexed by NetEndpointId; location runs first so weather uses the new city
+static const NetEndpoint netEndpoints[NET_EP_COUNT] = {
+    {"location", 24 * 3600, 256, netUrlLocation, netFilterLocation, netParseLocation},
+    {"weather",  30 * 60,   512, netUrlWeather,  netFilterWeather,  netParseWeather},
+    {"sun",      6 * 3600,  384, netUrlSun,      netFilterSun,      netParseSun},
+    {"currency", CURRENCY_UPDATE_INTERVAL / 1000, 384, netUrlCurrency, netFilterCurrency, netParseCurrency},
+};
+
+static String netCachePath(int idx) {
+    return String(SD_NET_CACHE_PATH) + "/" + netEndpoints[idx].name + ".json";
+}
+
+// Cache file: {"fetched":<epoch>,"body":<filtered response>}
+static void netWriteCache(int idx, JsonVariantConst body) {
+    if (!hasSD) return;
+    DynamicJsonDocument doc(netEndpoints[idx].docSize + 64);
+    doc["fetched"] = (uint32_t)netFetchedAt[idx];
+    doc["body"] = body;
+
+    String path = netCachePath(idx);
+    String tmpPath = path + ".tmp";
+    File f = SD_MMC.open(tmpPath.c_str(), FILE_WRITE);
+    if (!f) return;
+    serializeJson(doc, f);
+    f.close();
+    SD_MMC.remove(path.c_str());
+    SD_MMC.rename(tmpPath.c_str(), path.c_str());
+}
+
+// Boot: last good responses, applied before the first frame (setup only)
+void loadNetCache() {
+    strncpy(netCity, weatherCity, sizeof(netCity) - 1);
+    strncpy(netCountry, weatherCountry, sizeof(netCountry) - 1);
+    if (!hasSD) return;
+
+    uint32_t t0 = micros();
+    createDirectoryIfNotExists(SD_NET_CACHE_PATH);
+    for (int i = 0; i < NET_EP_COUNT; i++) {
+        File f = SD_MMC.open(netCachePath(i).c_str(), FILE_READ);
+        if (!f) continue;
+        DynamicJsonDocument doc(netEndpoints[i].docSize + 64);
+        DeserializationError err = deserializeJson(doc, f);
+        f.close();
+        if (err || !netEndpoints[i].parse(doc["body"].as<JsonVariantConst>())) continue;
+        netFetchedAt[i] = doc["fetched"].as<uint32_t>();
+        netStats[i].fromCache = true;
+    }
+    bootCacheLoadUs = micros() - t0;
+    applyNetResults(false);
+}
+
+static bool netFetchEndpoint(int idx) {
+    const NetEndpoint &ep = netEndpoints[idx];
+    NetEndpointStats &st = netStats[idx];
     char url[256];
-    snprintf(url, sizeof(url), "http://api.openweathermap.org/data/2.5/weather?q=%s,%s&appid=%s&units=metric",
-        weatherCity, weatherCountry, OPENWEATHER_API);
+    ep.buildUrl(url, sizeof(url));
 
+    StaticJsonDocument<192> filter;
+    ep.buildFilter(filter);
+    DynamicJsonDocument doc(ep.docSize);
+
+    uint32_t t0 = millis();
     HTTPClient http;
-    http.begin(url);
-    http.setTimeout(5000);
-
-    if (http.GET() == HTTP_CODE_OK) {
-        DynamicJsonDocument doc(1024);
-        if (deserializeJson(doc, http.getString()) == DeserializationError::Ok) {
-            weatherTemp = doc["main"]["temp"].as<float>();
-            weatherHigh = doc["main"]["temp_max"].as<float>();
-            weatherLow = doc["main"]["temp_min"].as<float>();
-            if (doc["weather"][0]["main"]) {
-                weatherDesc = doc["weather"][0]["main"].as<String>();
-            }
+    http.useHTTP10(true);   // No chunked encoding: the body streams straight into the parser
+    http.setConnectTimeout(NET_HTTP_TIMEOUT_MS);
+    http.setTimeout(NET_HTTP_TIMEOUT_MS);
+    bool ok = false;
+    if (http.begin(url)) {
+        st.lastCode = http.GET();
+        if (st.lastCode == HTTP_CODE_OK) {
+            ok = !deserializeJson(doc, http.getStream(), DeserializationOption::Filter(filter)) &&
+                 ep.parse(doc.as<JsonVariantConst>());
         }
+        http.end();
     }
-    http.end();
-    lastWeatherUpdate = millis();
+
+    st.fetches++;
+    st.lastLatencyMs = millis() - t0;
+    if (st.lastLatencyMs > st.maxLatencyMs) st.maxLatencyMs = st.lastLatencyMs;
+    if (!ok) {
+        st.failures++;
+        return false;
+    }
+    st.fromCache = false;
+    netFetchedAt[idx] = time(NULL);
+    // A pre-sync stamp is seconds since boot; cached, it would read as decades old
+    if (netFetchedAt[idx] >= NET_MIN_VALID_EPOCH) netWriteCache(idx, doc.as<JsonVariantConst>());
+    serialLogf("[NET] %s fetched in %lu ms\n", ep.name, (unsigned long)st.lastLatencyMs);
+    return true;
 }
 
-// Fetch location automatically based on IP address
-void fetchLocationFromIP() {
-    if (!wifiConnected) return;
+static void netOnTimeSync(struct timeval *tv) {
+    netTimeSynced = true;
+}
 
-    HTTPClient http;
-    // Use ip-api.com for free geolocation (no API key needed)
-    http.begin("http://ip-api.com/json/?fields=city,countryCode,status");
-    http.setTimeout(5000);
-
-    if (http.GET() == HTTP_CODE_OK) {
-        DynamicJsonDocument doc(512);
-        if (deserializeJson(doc, http.getString()) == DeserializationError::Ok) {
-            if (doc["status"] == "success") {
-                const char* city = doc["city"];
-                const char* country = doc["countryCode"];
-                if (city && strlen(city) > 0) {
-                    strncpy(weatherCity, city, sizeof(weatherCity) - 1);
-                    weatherCity[sizeof(weatherCity) - 1] = '\0';
-                }
-                if (country && strlen(country) > 0) {
-                    strncpy(weatherCountry, country, sizeof(weatherCountry) - 1);
-                    weatherCountry[sizeof(weatherCountry) - 1] = '\0';
-                }
-                // Save the new location
-                saveUserData();
-                // Fetch weather for new location
-                fetchWeatherData();
+static void net_task(void *param) {
+    sntp_set_time_sync_notification_cb(netOnTimeSync);
+    sntp_set_sync_interval(NTP_RESYNC_INTERVAL_MS);   // Each resync reaches the RTC via applyNetResults()
+
+    // First connection straight away; checkWiFiConnection() paces the rest
+    smartWiFiConnect();
+    lastWiFiCheck = millis();
+    bool justConnected = wifiConnected;
+
+    for (;;) {
+        if (justConnected) {
+            if (bootWifiMs == 0) bootWifiMs = millis();
+            configTime(gmtOffsetSec, DAYLIGHT_OFFSET_SEC, NTP_SERVER);
+            netForce |= NET_EP_BIT(NET_LOCATION);   // New network, maybe a new place
+        }
+
+        if (wifiConnected) {
+            time_t now = time(NULL);
+            bool clockValid = now >= NET_MIN_VALID_EPOCH;
+            for (int i = 0; i < NET_EP_COUNT; i++) {
+                const NetEndpoint &ep = netEndpoints[i];
+                bool forced = netForce.load() & NET_EP_BIT(i);
+                // Until NTP sets the clock a cached body's age is unknown: keep it
+                // rather than refetch everything on every boot. Bodies fetched
+                // before the sync carry a since-boot stamp and age normally.
+                bool stale;
+                if (netFetchedAt[i] == 0) stale = true;
+                else if (!clockValid && netFetchedAt[i] >= NET_MIN_VALID_EPOCH) stale = false;
+                else stale = (uint32_t)(now - netFetchedAt[i]) >= ep.ttlSec;
+                bool backoff = netAttempted[i] && millis() - netLastAttemptMs[i] < NET_RETRY_MS;
+                if (!forced && (!stale || backoff)) continue;
+
+                netForce &= ~NET_EP_BIT(i);
+                netAttempted[i] = true;
+                netLastAttemptMs[i] = millis();
+                // Weather follows a location that changed
+                if (netFetchEndpoint(i) && i == NET_LOCATION) netForce |= NET_EP_BIT(NET_WEATHER);
             }
         }
+
+        // Sleep until the next check or an explicit refresh request
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(NET_POLL_MS));
+        justConnected = checkWiFiConnection();
+    }
+}
+
+void startNetworkService() {
+    if (net_task_handle != NULL) return;
+    xTaskCreatePinnedToCore(net_task, "net_task", 8192, NULL, 1, &net_task_handle, 0);
+}
+
+// Ask net_task to refetch (NET_EP_BIT mask) now rather than at TTL expiry
+void netRequestRefresh(uint8_t endpoints) {
+    netForce |= endpoints;
+    if (net_task_handle != NULL) xTaskNotifyGive(net_task_handle);
+}
+
+// millis() stamp matching a body's fetch time, so "updated N min ago" stays
+// honest for cached values (unsigned wrap keeps the subtraction right)
+static unsigned long netFetchedMillis(int idx, time_t now) {
+    if (netFetchedAt[idx] == 0 || now < netFetchedAt[idx]) return millis();
+    return millis() - (unsigned long)(now - netFetchedAt[idx]) * 1000UL;
+}
+
+// Copy staged results into the globals the cards read (loop, and setup for
+// the cache). Also writes an NTP sync to the RTC, which shares loop()'s I2C.
+void applyNetResults(bool notifyUi) {
+    if (netTimeSynced.exchange(false)) {
+        if (bootNtpMs == 0) bootNtpMs = millis();
+        struct tm timeinfo;
+        if (hasRTC && getLocalTime(&timeinfo, 0)) {
+            rtc.setDateTime(timeinfo.tm_year + 1900, timeinfo.tm_mon + 1, timeinfo.tm_mday,
+                           timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
+            ntpSyncedOnce = true;
+            lastNTPSync = millis();
+        }
     }
-    http.end();
+
+    if (netPending.dirty == 0) return;
+    time_t now = time(NULL);
+    NetResults r;
+    portENTER_CRITICAL(&netLock);
+    r = netPending;
+    netPending.dirty = 0;
+    portEXIT_CRITICAL(&netLock);
+
+    if (r.dirty & NET_EP_BIT(NET_LOCATION)) {
+        bool cityChanged = strncmp(weatherCity, r.city, sizeof(weatherCity) - 1) != 0;
+        strncpy(weatherCity, r.city, sizeof(weatherCity) - 1);
+        strncpy(weatherCountry, r.country, sizeof(weatherCountry) - 1);
+        if (cityChanged) saveUserData();
+    }
+    if (r.dirty & NET_EP_BIT(NET_WEATHER)) {
+        weatherTemp = r.weatherTemp;
+        weatherHigh = r.weatherHigh;
+        weatherLow = r.weatherLow;
+        if (r.weatherDesc[0]) weatherDesc = r.weatherDesc;
+        lastWeatherUpdate = netFetchedMillis(NET_WEATHER, now);
+    }
+    if (r.dirty & NET_EP_BIT(NET_SUN)) {
+        memcpy(sunData.sunriseTime, r.sunrise, sizeof(sunData.sunriseTime));
+        memcpy(sunData.sunsetTime, r.sunset, sizeof(sunData.sunsetTime));
+        // Sunrise is roughly east (90), sunset is roughly west (270)
+        sunData.sunriseAzimuth = 90.0;
+        sunData.sunsetAzimuth = 270.0;
+        sunData.valid = true;
+        sunData.lastFetch = netFetchedMillis(NET_SUN, now);
+    }
+    if (r.dirty & NET_EP_BIT(NET_CURRENCY)) {
+        currencyData.usdRate = r.usdRate;
+        currencyData.audRate = r.audRate;
+        currencyData.valid = true;
+        currencyData.lastUpdate = netFetchedMillis(NET_CURRENCY, now);
+    }
+
+    if (notifyUi && screenOn) ui_post_event(UI_EVENT_REFRESH);
+}
+
+void printNetStats() {
+    USBSerial.printf("{\"type\":\"WIDGET_NET_STATS_RESPONSE\",\"wifi\":%s,\"first_frame_ms\":%lu,"
+                     "\"wifi_ms\":%lu,\"ntp_ms\":%lu,\"cache_load_us\":%lu,\"endpoints\":[",
+                     wifiConnected ? "true" : "false", (unsigned long)bootFirstFrameMs,
+                     (unsigned long)bootWifiMs, (unsigned long)bootNtpMs, (unsigned long)bootCacheLoadUs);
+    time_t now = time(NULL);
+    for (int i = 0; i < NET_EP_COUNT; i++) {
+        const NetEndpointStats &st = netStats[i];
+        long age = netFetchedAt[i] ? (long)(now - netFetchedAt[i]) : -1;
+        USBSerial.printf("%s{\"name\":\"%s\",\"fetches\":%lu,\"failures\":%lu,\"last_ms\":%lu,"
+                         "\"max_ms\":%lu,\"last_code\":%d,\"from_cache\":%s,\"age_s\":%ld}",
+                         i ? "," : "", netEndpoints[i].name, (unsigned long)st.fetches,
+                         (unsigned long)st.failures, (unsigned long)st.lastLatencyMs,
+                         (unsigned long)st.maxLatencyMs, st.lastCode,
+                         st.fromCache ? "true" : "false", age);
+    }
+    USBSerial.println("]}");
 }
 
 // fetchCryptoData() REMOVED - Space optimization
 
 // 
 //  SENSOR FUSION
-// 
+//  sensor_task (core 0) drains the QMI8658 FIFO in batches into a ring
+//  buffer, then runs the complementary filter and step detector over every
+//  sample with a fixed timestep. Results go out through a seqlock snapshot;
+//  loop() copies the latest one into the globals the cards read.
+// 
+#define IMU_USE_FIFO         1        // 0 = poll data-ready at the ODR instead
+#define IMU_SAMPLE_HZ        224.2f   // Gyro ODR - accel is synced to it in 6-axis mode
+#define IMU_BATCH_PERIOD_MS  40       // FIFO drain period (~9 samples per batch)
+#define IMU_FIFO_BATCH_MAX   64       // Matches FIFO_SAMPLES_64
+#define IMU_RING_SIZE        128      // Must be a power of two
+
+const float IMU_DT = 1.0f / IMU_SAMPLE_HZ;
+// Same filter time constant the old 50Hz loop had with ALPHA/BETA
+const float FUSION_TAU_S = 0.02f * ALPHA / BETA;
+const float STEP_PEAK_G = 1.3f;
+const float STEP_LPF_HZ = 4.0f;              // Keeps sensor noise out of the peak detector
+const uint32_t STEP_DEBOUNCE_SAMPLES = (uint32_t)(0.3f * IMU_SAMPLE_HZ);
+
+struct ImuSample {
+    IMUdata acc;
+    IMUdata gyr;
+};
+
+// Ring buffer between FIFO drain and processing (both in sensor_task)
+static ImuSample imuRing[IMU_RING_SIZE];
+static uint32_t imuRingHead = 0, imuRingTail = 0;
+uint32_t imuRingOverflows = 0;
+
+struct SensorSnapshot {
+    float roll, pitch, yaw;
+    float heading, headingSmooth;
+    IMUdata acc, gyr;
+    uint32_t steps;                 // Steps detected since boot
+    uint32_t samples;               // Samples processed since boot
+};
+
+static void publishSensorSnapshot(const SensorSnapshot &snap);
+static bool readSensorSnapshot(SensorSnapshot &out);
+
+static SensorSnapshot sensorSnapshot;
+static std::atomic<uint32_t> sensorSnapshotSeq(0);   // Odd while being written
+TaskHandle_t sensor_task_handle = NULL;
+
+uint32_t sensorStepsDetected = 0;   // From the last snapshot loop() read
+uint32_t sensorSamplesProcessed = 0;
+
+static void imuRingPush(const IMUdata &a, const IMUdata &g) {
+    if (imuRingHead - imuRingTail >= IMU_RING_SIZE) {
+        imuRingTail++;              // Drop the oldest sample
+        imuRingOverflows++;
+    }
+    ImuSample &slot = imuRing[imuRingHead & (IMU_RING_SIZE - 1)];
+    slot.acc = a;
+    slot.gyr = g;
+    imuRingHead++;
+}
+
+static void publishSensorSnapshot(const SensorSnapshot &snap) {
+    uint32_t seq = sensorSnapshotSeq.load(std::memory_order_relaxed);
+    sensorSnapshotSeq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    sensorSnapshot = snap;
+    sensorSnapshotSeq.store(seq + 2, std::memory_order_release);
+}
+
+static bool readSensorSnapshot(SensorSnapshot &out) {
+    for (int tries = 0; tries < 4; tries++) {
+        uint32_t before = sensorSnapshotSeq.load(std::memory_order_acquire);
+        if (before & 1) continue;
+        out = sensorSnapshot;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sensorSnapshotSeq.load(std::memory_order_relaxed) == before) return true;
+    }
+    return false;
+}
+
+struct FusionState {
+    float roll, pitch, yaw;
+    float heading, headingSmooth;
+    float magLp, prevMag, prevPrevMag;
+    uint32_t samplesSinceStep;
+    uint32_t steps;
+    uint32_t samples;
+};
+
+static void processImuSample(FusionState &f, const ImuSample &s);
+
+static void processImuSample(FusionState &f, const ImuSample &s) {
+    static const float alpha = FUSION_TAU_S / (FUSION_TAU_S + IMU_DT);
+    static const float smoothK = 1.0f - powf(0.9f, 0.02f / IMU_DT);  // Old 0.1 per 20ms
+    static const float stepK = IMU_DT / (IMU_DT + 1.0f / (2.0f * PI * STEP_LPF_HZ));
+
+    // Accelerometer angles
+    float aRoll = atan2f(s.acc.y, s.acc.z) * 180.0f / PI;
+    float aPitch = atan2f(-s.acc.x, sqrtf(s.acc.y * s.acc.y + s.acc.z * s.acc.z)) * 180.0f / PI;
+
+    // Complementary filter
+    f.roll = alpha * (f.roll + s.gyr.x * IMU_DT) + (1.0f - alpha) * aRoll;
+    f.pitch = alpha * (f.pitch + s.gyr.y * IMU_DT) + (1.0f - alpha) * aPitch;
+    f.yaw += s.gyr.z * IMU_DT;
+
+    // Compass heading
+    f.heading = f.yaw - initialYaw;
+    while (f.heading < 0) f.heading += 360;
+    while (f.heading >= 360) f.heading -= 360;
+
+    // Smooth compass
+    float diff = f.heading - f.headingSmooth;
+    if (diff > 180) diff -= 360;
+    if (diff < -180) diff += 360;
+    f.headingSmooth += diff * smoothK;
+    if (f.headingSmooth < 0) f.headingSmooth += 360;
+    if (f.headingSmooth >= 360) f.headingSmooth -= 360;
+
+    // Step detection - peak in low-passed accel magnitude
+    float mag = sqrtf(s.acc.x * s.acc.x + s.acc.y * s.acc.y + s.acc.z * s.acc.z);
+    f.magLp += stepK * (mag - f.magLp);
+    if (f.prevMag > f.prevPrevMag && f.prevMag > f.magLp && f.prevMag > STEP_PEAK_G &&
+        f.samplesSinceStep > STEP_DEBOUNCE_SAMPLES) {
+        f.steps++;
+        f.samplesSinceStep = 0;
+    }
+    f.samplesSinceStep++;
+    f.prevPrevMag = f.prevMag;
+    f.prevMag = f.magLp;
+    f.samples++;
+}
+
+static void sensor_task(void *pvParameters) {
+    FusionState f = {};
+    f.magLp = f.prevMag = f.prevPrevMag = 1.0f;
+    ImuSample last = {};
+
+#if IMU_USE_FIFO
+    static IMUdata fifoAcc[IMU_FIFO_BATCH_MAX], fifoGyr[IMU_FIFO_BATCH_MAX];
+    const TickType_t period = pdMS_TO_TICKS(IMU_BATCH_PERIOD_MS);
+#else
+    const TickType_t period = pdMS_TO_TICKS(4) > 0 ? pdMS_TO_TICKS(4) : 1;
+#endif
+    TickType_t lastWake = xTaskGetTickCount();
+
+    while (true) {
+        vTaskDelayUntil(&lastWake, period);
+
+#if IMU_USE_FIFO
+        uint16_t n = qmi.readFromFifo(fifoAcc, IMU_FIFO_BATCH_MAX, fifoGyr, IMU_FIFO_BATCH_MAX);
+        for (uint16_t i = 0; i < n; i++) imuRingPush(fifoAcc[i], fifoGyr[i]);
+#else
+        if (qmi.getDataReady()) {
+            IMUdata a, g;
+            qmi.getAccelerometer(a.x, a.y, a.z);
+            qmi.getGyroscope(g.x, g.y, g.z);
+            imuRingPush(a, g);
+        }
+#endif
+
+        bool any = false;
+        while (imuRingTail != imuRingHead) {
+            last = imuRing[imuRingTail & (IMU_RING_SIZE - 1)];
+            imuRingTail++;
+            processImuSample(f, last);
+            any = true;
+        }
+        if (!any) continue;
+
+        SensorSnapshot snap;
+        snap.roll = f.roll;
+        snap.pitch = f.pitch;
+        snap.yaw = f.yaw;
+        snap.heading = f.heading;
+        snap.headingSmooth = f.headingSmooth;
+        snap.acc = last.acc;
+        snap.gyr = last.gyr;
+        snap.steps = f.steps;
+        snap.samples = f.samples;
+        publishSensorSnapshot(snap);
+    }
+}
+
+void startSensorTask() {
+#if IMU_USE_FIFO
+    // Stream mode keeps the newest 64 samples if a batch is ever late
+    qmi.configFIFO(SensorQMI8658::FIFO_MODE_STREAM, SensorQMI8658::FIFO_SAMPLES_64,
+                   SensorQMI8658::INTERRUPT_PIN_DISABLE, 16);
+#endif
+    xTaskCreatePinnedToCore(
+        sensor_task,    // Task function
+        "sensor_task",  // Task name
+        4096,           // Stack size
+        NULL,           // Parameters
+        3,              // Priority (above loop and ui_task - short bursts only)
+        &sensor_task_handle,
+        0               // Pin to Core 0
+    );
+}
+
+// Copy the latest fusion snapshot into the globals the cards read (loop)
 void updateSensorFusion() {
     if (!hasIMU) return;
 
-    unsigned long now = millis();
-    float dt = (now - lastSensorUpdate) / 1000.0;
-    if (dt <= 0 || dt > 1.0) dt = 0.01;
-    lastSensorUpdate = now;
-
-    if (qmi.getDataReady()) {
-        qmi.getAccelerometer(acc.x, acc.y, acc.z);
-        qmi.getGyroscope(gyr.x, gyr.y, gyr.z);
-    
-        // Accelerometer angles
-        accelRoll = atan2(acc.y, acc.z) * 180.0 / PI;
-        accelPitch = atan2(-acc.x, sqrt(acc.y * acc.y + acc.z * acc.z)) * 180.0 / PI;
-    
-        // Gyro integration
-        gyroRoll += gyr.x * dt;
-        gyroPitch += gyr.y * dt;
-        gyroYaw += gyr.z * dt;
-    
-        // Complementary filter
-        roll = ALPHA * (roll + gyr.x * dt) + BETA * accelRoll;
-        pitch = ALPHA * (pitch + gyr.y * dt) + BETA * accelPitch;
-        yaw = gyroYaw;
-    
-        // Compass heading
-        compassHeading = yaw - initialYaw;
-        while (compassHeading < 0) compassHeading += 360;
-        while (compassHeading >= 360) compassHeading -= 360;
-    
-        // Smooth compass
-        float diff = compassHeading - compassHeadingSmooth;
-        if (diff > 180) diff -= 360;
-        if (diff < -180) diff += 360;
-        compassHeadingSmooth += diff * 0.1;
-    
-        // Tilt values
-        tiltX = roll;
-        tiltY = pitch;
+    SensorSnapshot snap;
+    if (!readSensorSnapshot(snap)) return;
+
+    acc = snap.acc;
+    gyr = snap.gyr;
+    roll = snap.roll;
+    pitch = snap.pitch;
+    yaw = snap.yaw;
+    gyroYaw = snap.yaw;
+    compassHeading = snap.heading;
+    compassHeadingSmooth = snap.headingSmooth;
+    sensorStepsDetected = snap.steps;
+    sensorSamplesProcessed = snap.samples;
+    lastSensorUpdate = millis();
+
+    // Tilt values
+    tiltX = roll;
+    tiltY = pitch;
+}
+
+// Offline replay of a recorded trace through the same fusion/step code.
+// WIDGET_IMU_TRACE, then one "ax,ay,az,gx,gy,gz" line per sample (g, dps)
+// at IMU_SAMPLE_HZ, then END_IMU_TRACE.
+static FusionState traceFusion;
+static uint32_t traceProcessUs = 0;
+static uint32_t traceBadLines = 0;
+
+void beginImuTraceReplay() {
+    memset(&traceFusion, 0, sizeof(traceFusion));
+    traceFusion.magLp = traceFusion.prevMag = traceFusion.prevPrevMag = 1.0f;
+    traceProcessUs = 0;
+    traceBadLines = 0;
+}
+
+void feedImuTraceLine(const String& line) {
+    ImuSample sample;
+    if (sscanf(line.c_str(), "%f,%f,%f,%f,%f,%f",
+               &sample.acc.x, &sample.acc.y, &sample.acc.z,
+               &sample.gyr.x, &sample.gyr.y, &sample.gyr.z) != 6) {
+        traceBadLines++;
+        return;
     }
+    uint32_t t = micros();
+    processImuSample(traceFusion, sample);
+    traceProcessUs += micros() - t;
+}
+
+void endImuTraceReplay() {
+    float perSec = traceProcessUs > 0 ? traceFusion.samples * 1000000.0f / traceProcessUs : 0;
+    USBSerial.printf("{\"type\":\"WIDGET_IMU_TRACE_RESPONSE\",\"samples\":%lu,\"bad_lines\":%lu,"
+                     "\"steps\":%lu,\"roll\":%.2f,\"pitch\":%.2f,\"heading\":%.2f,"
+                     "\"process_us\":%lu,\"samples_per_sec\":%.0f}\n",
+                     (unsigned long)traceFusion.samples, (unsigned long)traceBadLines,
+                     (unsigned long)traceFusion.steps, traceFusion.roll, traceFusion.pitch,
+                     traceFusion.heading, (unsigned long)traceProcessUs, perSec);
 }
 
 void calibrateCompass() {
@@ -2342,29 +3388,162 @@ void drawLowBatteryPopup() {
     lv_obj_align(hint, LV_ALIGN_BOTTOM_MID, 0, -20);
 }
 
-// 
-//  MAIN NAVIGATION - SAFE VERSION
-// 
-void navigateTo(int category, int subCard) {
-    // SAFETY: Validate bounds first
-    if (category < 0 || category >= NUM_CATEGORIES) {
-        category = CAT_CLOCK;
-    }
-    if (subCard < 0 || subCard >= maxSubCards[category]) {
-        subCard = 0;
-    }
+// ═══════════════════════════════════════════════════════════════════════════
+//  INCREMENTAL CARD UPDATES
+//  Cards that refresh periodically keep handles to their live widgets and
+//  register an update hook. UI_EVENT_REFRESH calls the hook, which only
+//  touches labels/positions/arc values. A full navigateTo() rebuild only
+//  happens on a real category/sub-card change, or when the hook returns
+//  false because the card layout itself must change (e.g. game over).
+// ═══════════════════════════════════════════════════════════════════════════
 
-    // FIX: Unlock at the START to prevent permanent lock if function fails
-    navigationLocked = false;
-    isTransitioning = false;
+typedef bool (*CardUpdateFn)();
+void setCardUpdateHook(CardUpdateFn fn);
+
+CardUpdateFn activeCardUpdate = NULL;   // Set by createXxxCard(), cleared by navigateTo()
+int activeCardCategory = -1;
+int activeCardSubCard = -1;
+
+// Per-card refresh cost, so steady-state refreshes can be shown to allocate nothing
+struct CardPerfStats {
+    uint32_t rebuilds;           // Full navigateTo() rebuilds
+    uint32_t updates;            // In-place hook refreshes
+    uint32_t lastObjsCreated;    // LVGL objects created by the last refresh
+    int32_t lastHeapAllocs;      // Net LVGL heap allocations by the last refresh
+    uint32_t maxUpdateObjs;      // Worst case objects created by an in-place update
+    uint32_t lastPixelsFlushed;  // Pixels flushed after the last refresh
+};
 
-    // Update state
-    currentCategory = category;
-    currentSubCard = subCard;
+CardPerfStats cardPerf[NUM_CATEGORIES][MAX_SUB_CARDS] = {};
+static int perfFlushCategory = -1;
+static int perfFlushSubCard = -1;
+static uint32_t perfFlushMark = 0;
 
-    // Reset notification overlay pointer before cleaning screen
-    // (lv_obj_clean will delete all objects including the overlay)
-    // notificationOverlay cleanup disabled
+static uint32_t countObjTree(lv_obj_t *obj) {
+    uint32_t n = 1;
+    uint32_t childCnt = lv_obj_get_child_cnt(obj);
+    for (uint32_t i = 0; i < childCnt; i++) {
+        n += countObjTree(lv_obj_get_child(obj, i));
+    }
+    return n;
+}
+
+static int32_t lvglHeapUsedCount() {
+#if LV_MEM_CUSTOM == 0
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return (int32_t)mon.used_cnt;
+#else
+    return 0;
+#endif
+}
+
+// Attribute pixels flushed since the previous refresh to the card that caused them
+static void perfCloseFlushWindow(int category, int subCard) {
+    uint32_t now = flushedPixelCount;
+    if (perfFlushCategory >= 0) {
+        cardPerf[perfFlushCategory][perfFlushSubCard].lastPixelsFlushed = now - perfFlushMark;
+    }
+    perfFlushMark = now;
+    perfFlushCategory = category;
+    perfFlushSubCard = subCard;
+}
+
+// Only touch the label (and invalidate its area) if the text actually changed
+void setLabelTextIfChanged(lv_obj_t *label, const char *text) {
+    if (label == NULL) return;
+    const char *cur = lv_label_get_text(label);
+    if (cur != NULL && strcmp(cur, text) == 0) return;
+    lv_label_set_text(label, text);
+}
+
+// Style setters always invalidate, so skip them when the colour is unchanged
+void setTextColorIfChanged(lv_obj_t *obj, lv_color_t color) {
+    if (obj == NULL) return;
+    if (lv_obj_get_style_text_color(obj, LV_PART_MAIN).full == color.full) return;
+    lv_obj_set_style_text_color(obj, color, 0);
+}
+
+void setBgColorIfChanged(lv_obj_t *obj, lv_color_t color) {
+    if (obj == NULL) return;
+    if (lv_obj_get_style_bg_color(obj, LV_PART_MAIN).full == color.full) return;
+    lv_obj_set_style_bg_color(obj, color, 0);
+}
+
+void setCardUpdateHook(CardUpdateFn fn) {
+    activeCardUpdate = fn;
+}
+
+// Refresh the visible card: in-place if it has a hook, full rebuild otherwise
+void refreshCurrentCard() {
+    if (activeCardUpdate != NULL &&
+        activeCardCategory == currentCategory &&
+        activeCardSubCard == currentSubCard) {
+        perfCloseFlushWindow(currentCategory, currentSubCard);
+
+        uint32_t objsBefore = countObjTree(lv_scr_act());
+        int32_t heapBefore = lvglHeapUsedCount();
+
+        if (activeCardUpdate()) {
+            uint32_t objsAfter = countObjTree(lv_scr_act());
+            CardPerfStats &s = cardPerf[currentCategory][currentSubCard];
+            s.updates++;
+            s.lastObjsCreated = objsAfter > objsBefore ? objsAfter - objsBefore : 0;
+            s.lastHeapAllocs = lvglHeapUsedCount() - heapBefore;
+            if (s.lastObjsCreated > s.maxUpdateObjs) s.maxUpdateObjs = s.lastObjsCreated;
+            return;
+        }
+    }
+    navigateTo(currentCategory, currentSubCard);
+}
+
+void printCardPerfStats() {
+    USBSerial.println("{\"type\":\"WIDGET_CARD_STATS_RESPONSE\",\"cards\":[");
+    bool first = true;
+    for (int c = 0; c < NUM_CATEGORIES; c++) {
+        for (int s = 0; s < maxSubCards[c]; s++) {
+            CardPerfStats &p = cardPerf[c][s];
+            if (p.rebuilds == 0 && p.updates == 0) continue;
+            USBSerial.printf("%s{\"cat\":%d,\"sub\":%d,\"rebuilds\":%lu,\"updates\":%lu,"
+                             "\"objs\":%lu,\"heap_allocs\":%ld,\"max_update_objs\":%lu,\"pixels\":%lu}\n",
+                             first ? "" : ",", c, s,
+                             (unsigned long)p.rebuilds, (unsigned long)p.updates,
+                             (unsigned long)p.lastObjsCreated, (long)p.lastHeapAllocs,
+                             (unsigned long)p.maxUpdateObjs, (unsigned long)p.lastPixelsFlushed);
+            first = false;
+        }
+    }
+    USBSerial.println("]}");
+}
+
+// 
+//  MAIN NAVIGATION - SAFE VERSION
+// 
+void navigateTo(int category, int subCard) {
+    // SAFETY: Validate bounds first
+    if (category < 0 || category >= NUM_CATEGORIES) {
+        category = CAT_CLOCK;
+    }
+    if (subCard < 0 || subCard >= maxSubCards[category]) {
+        subCard = 0;
+    }
+
+    // FIX: Unlock at the START to prevent permanent lock if function fails
+    navigationLocked = false;
+    isTransitioning = false;
+
+    // Update state
+    currentCategory = category;
+    currentSubCard = subCard;
+
+    // Old widget handles die with lv_obj_clean() - card creators re-register
+    activeCardUpdate = NULL;
+    perfCloseFlushWindow(category, subCard);
+    int32_t heapBefore = lvglHeapUsedCount();
+
+    // Reset notification overlay pointer before cleaning screen
+    // (lv_obj_clean will delete all objects including the overlay)
+    // notificationOverlay cleanup disabled
 
     // Clean screen and rebuild
     lv_obj_clean(lv_scr_act());
@@ -2390,7 +3569,10 @@ void navigateTo(int category, int subCard) {
 
     switch (category) {
         case CAT_CLOCK:
-            if (subCard == 0) createClockCard();
+            if (subCard == 0) {
+                if (customFaceActive()) createCustomFaceCard();
+                else createClockCard();
+            }
             else if (subCard == 1) createAnalogClockCard();
             else if (subCard == 2) createWorldClockCard(0, "Ghana", "Accra");      // UTC+0
             else if (subCard == 3) createWorldClockCard(9, "Japan", "Tokyo");      // UTC+9
@@ -2461,6 +3643,13 @@ void navigateTo(int category, int subCard) {
 
     createNavDots();
 
+    activeCardCategory = category;
+    activeCardSubCard = subCard;
+    CardPerfStats &perf = cardPerf[category][subCard];
+    perf.rebuilds++;
+    perf.lastObjsCreated = countObjTree(lv_scr_act()) - 1;  // Everything but the screen is new
+    perf.lastHeapAllocs = lvglHeapUsedCount() - heapBefore;
+
     // Low battery popup disabled - was causing issues
     // if (showingLowBatteryPopup) {
     //     drawLowBatteryPopup();
@@ -2612,6 +3801,21 @@ void createSDCardHealthCard() {
 // 
 //  PREMIUM CLOCK CARD
 // 
+// Live widgets for updateClockCard()
+static lv_obj_t *clockTimeLbl = NULL, *clockSecLbl = NULL, *clockDayLbl = NULL, *clockDateLbl = NULL;
+static lv_obj_t *clockWifiIcon = NULL, *clockEstLbl = NULL, *clockBattLbl = NULL, *clockStepLbl = NULL;
+
+static const char* clockDayNames[] = {"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
+static const char* clockMonthNames[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+static void formatBatteryEstimate(char *buf, size_t len) {
+    uint32_t hrs = batteryStats.combinedEstimateMins / 60;
+    uint32_t mins = batteryStats.combinedEstimateMins % 60;
+    if (isCharging) snprintf(buf, len, LV_SYMBOL_CHARGE);
+    else if (hrs > 0) snprintf(buf, len, "~%luh", hrs);
+    else snprintf(buf, len, "~%lum", mins);
+}
+
 void createClockCard() {
     GradientTheme &theme = gradientThemes[userData.themeIndex];
 
@@ -2650,6 +3854,7 @@ void createClockCard() {
     snprintf(timeBuf, sizeof(timeBuf), "%02d:%02d", dt.getHour(), dt.getMinute());
 
     lv_obj_t *clockLabel = lv_label_create(card);
+    clockTimeLbl = clockLabel;
     lv_label_set_text(clockLabel, timeBuf);
     lv_obj_set_style_text_color(clockLabel, lv_color_hex(0xFFFFFF), 0);
     lv_obj_set_style_text_font(clockLabel, &lv_font_montserrat_48, 0);
@@ -2659,24 +3864,25 @@ void createClockCard() {
     char secBuf[8];
     snprintf(secBuf, sizeof(secBuf), ":%02d", dt.getSecond());
     lv_obj_t *secLabel = lv_label_create(card);
+    clockSecLbl = secLabel;
     lv_label_set_text(secLabel, secBuf);
     lv_obj_set_style_text_color(secLabel, theme.accent, 0);
     lv_obj_set_style_text_font(secLabel, &lv_font_montserrat_20, 0);
     lv_obj_align_to(secLabel, clockLabel, LV_ALIGN_OUT_RIGHT_BOTTOM, 5, -5);
 
     // Day name - below time with spacing
-    const char* dayNames[] = {"Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday"};
     lv_obj_t *dayLabel = lv_label_create(card);
-    lv_label_set_text(dayLabel, dayNames[dt.getWeek()]);
+    clockDayLbl = dayLabel;
+    lv_label_set_text(dayLabel, clockDayNames[dt.getWeek()]);
     lv_obj_set_style_text_color(dayLabel, lv_color_hex(0x8E8E93), 0);
     lv_obj_set_style_text_font(dayLabel, &lv_font_montserrat_18, 0);
     lv_obj_align(dayLabel, LV_ALIGN_TOP_MID, 0, 110);
 
     // Full date - below day name
     char dateBuf[32];
-    const char* monthNames[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
-    snprintf(dateBuf, sizeof(dateBuf), "%s %d, %d", monthNames[dt.getMonth()-1], dt.getDay(), dt.getYear());
+    snprintf(dateBuf, sizeof(dateBuf), "%s %d, %d", clockMonthNames[dt.getMonth()-1], dt.getDay(), dt.getYear());
     lv_obj_t *dateLabel = lv_label_create(card);
+    clockDateLbl = dateLabel;
     lv_label_set_text(dateLabel, dateBuf);
     lv_obj_set_style_text_color(dateLabel, theme.accent, 0);
     lv_obj_set_style_text_font(dateLabel, &lv_font_montserrat_16, 0);
@@ -2700,6 +3906,7 @@ void createClockCard() {
 
     // WiFi indicator
     lv_obj_t *wifiIcon = lv_label_create(statusBar);
+    clockWifiIcon = wifiIcon;
     lv_label_set_text(wifiIcon, LV_SYMBOL_WIFI);
     lv_obj_set_style_text_color(wifiIcon, wifiConnected ? lv_color_hex(0x30D158) : lv_color_hex(0xFF453A), 0);
     lv_obj_set_style_text_font(wifiIcon, &lv_font_montserrat_16, 0);
@@ -2708,12 +3915,9 @@ void createClockCard() {
     // Battery estimate
     calculateBatteryEstimates();
     char estBuf[16];
-    uint32_t hrs = batteryStats.combinedEstimateMins / 60;
-    uint32_t mins = batteryStats.combinedEstimateMins % 60;
-    if (isCharging) snprintf(estBuf, sizeof(estBuf), LV_SYMBOL_CHARGE);
-    else if (hrs > 0) snprintf(estBuf, sizeof(estBuf), "~%luh", hrs);
-    else snprintf(estBuf, sizeof(estBuf), "~%lum", mins);
+    formatBatteryEstimate(estBuf, sizeof(estBuf));
     lv_obj_t *estLabel = lv_label_create(statusBar);
+    clockEstLbl = estLabel;
     lv_label_set_text(estLabel, estBuf);
     lv_obj_set_style_text_color(estLabel, isCharging ? lv_color_hex(0x30D158) : lv_color_hex(0x8E8E93), 0);
     lv_obj_set_style_text_font(estLabel, &lv_font_montserrat_14, 0);
@@ -2723,6 +3927,7 @@ void createClockCard() {
     char battBuf[8];
     snprintf(battBuf, sizeof(battBuf), "%d%%", batteryPercent);
     lv_obj_t *battLabel = lv_label_create(statusBar);
+    clockBattLbl = battLabel;
     lv_label_set_text(battLabel, battBuf);
     lv_obj_set_style_text_color(battLabel, batteryPercent > 20 ? lv_color_hex(0x30D158) : lv_color_hex(0xFF453A), 0);
     lv_obj_set_style_text_font(battLabel, &lv_font_montserrat_14, 0);
@@ -2732,115 +3937,254 @@ void createClockCard() {
     char stepBuf[16];
     snprintf(stepBuf, sizeof(stepBuf), "%lu", (unsigned long)userData.steps);
     lv_obj_t *stepLabel = lv_label_create(statusBar);
+    clockStepLbl = stepLabel;
     lv_label_set_text(stepLabel, stepBuf);
     lv_obj_set_style_text_color(stepLabel, theme.accent, 0);
     lv_obj_set_style_text_font(stepLabel, &lv_font_montserrat_14, 0);
     lv_obj_align(stepLabel, LV_ALIGN_RIGHT_MID, -10, 0);
+
+    setCardUpdateHook(updateClockCard);
+}
+
+bool updateClockCard() {
+    RTC_DateTime dt = rtc.getDateTime();
+    char buf[32];
+
+    snprintf(buf, sizeof(buf), "%02d:%02d", dt.getHour(), dt.getMinute());
+    const char *curTime = lv_label_get_text(clockTimeLbl);
+    if (strcmp(curTime, buf) != 0) {
+        lv_label_set_text(clockTimeLbl, buf);
+        // Width of the HH:MM label can change, keep seconds attached to it
+        lv_obj_update_layout(clockTimeLbl);
+        lv_obj_align_to(clockSecLbl, clockTimeLbl, LV_ALIGN_OUT_RIGHT_BOTTOM, 5, -5);
+    }
+
+    snprintf(buf, sizeof(buf), ":%02d", dt.getSecond());
+    setLabelTextIfChanged(clockSecLbl, buf);
+
+    setLabelTextIfChanged(clockDayLbl, clockDayNames[dt.getWeek()]);
+    snprintf(buf, sizeof(buf), "%s %d, %d", clockMonthNames[dt.getMonth()-1], dt.getDay(), dt.getYear());
+    setLabelTextIfChanged(clockDateLbl, buf);
+
+    setTextColorIfChanged(clockWifiIcon, wifiConnected ? lv_color_hex(0x30D158) : lv_color_hex(0xFF453A));
+
+    calculateBatteryEstimates();
+    formatBatteryEstimate(buf, sizeof(buf));
+    setLabelTextIfChanged(clockEstLbl, buf);
+    setTextColorIfChanged(clockEstLbl, isCharging ? lv_color_hex(0x30D158) : lv_color_hex(0x8E8E93));
+
+    snprintf(buf, sizeof(buf), "%d%%", batteryPercent);
+    setLabelTextIfChanged(clockBattLbl, buf);
+    setTextColorIfChanged(clockBattLbl, batteryPercent > 20 ? lv_color_hex(0x30D158) : lv_color_hex(0xFF453A));
+
+    snprintf(buf, sizeof(buf), "%lu", (unsigned long)userData.steps);
+    setLabelTextIfChanged(clockStepLbl, buf);
+    return true;
+}
+
+// 
+//  DIAL LAYERS & TRIG TABLE
+// 
+// Sine in Q15 for whole degrees 0..90, evaluated by the compiler (Taylor
+// series, error < 1e-5) so the table lands in flash with no boot-time cost.
+constexpr double ctSinRad(double x) {
+    return x * (1 - x * x / 6 * (1 - x * x / 20 * (1 - x * x / 42 * (1 - x * x / 72))));
+}
+#define SIN_Q15(d) ((int16_t)(ctSinRad((d) * 3.14159265358979 / 180.0) * 32767.0 + 0.5))
+#define SIN_ROW(d) SIN_Q15(d), SIN_Q15(d + 1), SIN_Q15(d + 2), SIN_Q15(d + 3), SIN_Q15(d + 4), \
+                   SIN_Q15(d + 5), SIN_Q15(d + 6), SIN_Q15(d + 7), SIN_Q15(d + 8), SIN_Q15(d + 9)
+static const int16_t sinTableQ15[91] = {
+    SIN_ROW(0), SIN_ROW(10), SIN_ROW(20), SIN_ROW(30), SIN_ROW(40),
+    SIN_ROW(50), SIN_ROW(60), SIN_ROW(70), SIN_ROW(80), SIN_Q15(90)
+};
+
+static inline int32_t isinDeg(int deg) {
+    deg %= 360;
+    if (deg < 0) deg += 360;
+    if (deg <= 90) return sinTableQ15[deg];
+    if (deg <= 180) return sinTableQ15[180 - deg];
+    if (deg <= 270) return -sinTableQ15[deg - 180];
+    return -sinTableQ15[360 - deg];
+}
+
+// Offset of a point `len` px from a dial centre at a clock angle
+// (0 = 12 o'clock, clockwise), in screen coordinates
+static inline lv_coord_t dialDX(int deg, int len) { return (isinDeg(deg) * len) / 32767; }
+static inline lv_coord_t dialDY(int deg, int len) { return -(isinDeg(deg + 90) * len) / 32767; }
+
+// Static dial artwork (bezel, ticks, numerals) is painted once into a PSRAM
+// canvas and shown as a single image, so a card rebuild creates one object
+// instead of ~60 and a frame blits one image instead of redrawing each tick.
+// Only the theme changes the artwork, so it is repainted when that changes.
+// The layer is ARGB over the card's gradient; LVGL 8.3 canvas drawing only
+// writes a valid alpha channel when LV_COLOR_SCREEN_TRANSP is enabled.
+#if !LV_COLOR_SCREEN_TRANSP
+#error "Dial layers need LV_COLOR_SCREEN_TRANSP 1 in lv_conf.h (canvas alpha is garbage otherwise)"
+#endif
+
+struct DialCache {
+    lv_color_t *buf;          // PSRAM, sized for the dial on first use
+    lv_img_dsc_t img;
+    int themeIndex;           // Theme the buffer was painted for, -1 = empty
+};
+typedef void (*DialPainter)(lv_obj_t *canvas, lv_coord_t w, lv_coord_t h, GradientTheme &theme);
+static const lv_img_dsc_t *getDialImage(DialCache &cache, lv_coord_t w, lv_coord_t h, DialPainter paint);
+static void paintAnalogDial(lv_obj_t *canvas, lv_coord_t w, lv_coord_t h, GradientTheme &theme);
+static void paintCompassDial(lv_obj_t *canvas, lv_coord_t w, lv_coord_t h, GradientTheme &theme);
+
+static DialCache analogDial = {NULL, {}, -1};
+static DialCache compassDial = {NULL, {}, -1};
+
+static const lv_img_dsc_t *getDialImage(DialCache &cache, lv_coord_t w, lv_coord_t h, DialPainter paint) {
+    int themeIdx = userData.themeIndex;
+    if (cache.buf != NULL && cache.themeIndex == themeIdx) return &cache.img;
+
+    if (cache.buf == NULL) {
+        cache.buf = (lv_color_t *)heap_caps_malloc(LV_CANVAS_BUF_SIZE_TRUE_COLOR_ALPHA(w, h),
+                                                   MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (cache.buf == NULL) {
+            serialLogf("[DIAL] No PSRAM for %dx%d dial layer\n", w, h);
+            return NULL;
+        }
+    }
+
+    uint32_t t0 = micros();
+    lv_obj_t *canvas = lv_canvas_create(lv_scr_act());
+    lv_obj_add_flag(canvas, LV_OBJ_FLAG_HIDDEN);
+    lv_canvas_set_buffer(canvas, cache.buf, w, h, LV_IMG_CF_TRUE_COLOR_ALPHA);
+    lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_TRANSP);
+    paint(canvas, w, h, gradientThemes[themeIdx]);
+    cache.img = *lv_canvas_get_img(canvas);
+    lv_obj_del(canvas);  // The buffer is ours, the canvas was only the painter
+
+    lv_img_cache_invalidate_src(&cache.img);
+    cache.themeIndex = themeIdx;
+    serialLogf("[DIAL] Painted %dx%d layer in %lu us\n", w, h, (unsigned long)(micros() - t0));
+    return &cache.img;
+}
+
+static void canvasDot(lv_obj_t *canvas, lv_coord_t cx, lv_coord_t cy, lv_coord_t d, lv_color_t color) {
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.radius = LV_RADIUS_CIRCLE;
+    dsc.bg_color = color;
+    lv_canvas_draw_rect(canvas, cx - d / 2, cy - d / 2, d, d, &dsc);
+}
+
+static void canvasTextCentered(lv_obj_t *canvas, lv_coord_t cx, lv_coord_t cy, const char *txt,
+                               const lv_font_t *font, lv_color_t color) {
+    lv_point_t size;
+    lv_txt_get_size(&size, txt, font, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+    lv_draw_label_dsc_t dsc;
+    lv_draw_label_dsc_init(&dsc);
+    dsc.color = color;
+    dsc.font = font;
+    lv_canvas_draw_text(canvas, cx - size.x / 2, cy - size.y / 2, size.x + 1, &dsc, txt);
 }
 
 // 
 //  ANALOG CLOCK CARD - Premium Design
 // 
-void createAnalogClockCard() {
-    GradientTheme &theme = gradientThemes[userData.themeIndex];
+// Live widgets for updateAnalogClockCard()
+static lv_obj_t *analogHourHand = NULL, *analogMinHand = NULL, *analogSecHand = NULL, *analogDateLbl = NULL;
+static const char* analogMonthShort[] = {"JAN", "FEB", "MAR", "APR", "MAY", "JUN", "JUL", "AUG", "SEP", "OCT", "NOV", "DEC"};
 
-    // Full screen dark background
-    lv_obj_t *bg = lv_obj_create(lv_scr_act());
-    lv_obj_set_size(bg, LCD_WIDTH, LCD_HEIGHT);
-    lv_obj_align(bg, LV_ALIGN_CENTER, 0, 0);
-    lv_obj_set_style_bg_color(bg, lv_color_hex(0x0A0A0A), 0);
-    lv_obj_set_style_radius(bg, 0, 0);
-    lv_obj_set_style_border_width(bg, 0, 0);
-    disableAllScrolling(bg);
+// Hands are upright bars offset half their length along the hand angle
+static void placeAnalogHand(lv_obj_t *hand, int angleDeg, int len) {
+    lv_obj_set_pos(hand, dialDX(angleDeg, len) / 2, dialDY(angleDeg, len) / 2);
+}
+
+// Glow ring (230px + 40px shadow) with the face, markers and ticks centred in it
+#define ANALOG_DIAL_SIZE 280
+
+static void paintAnalogDial(lv_obj_t *canvas, lv_coord_t w, lv_coord_t h, GradientTheme &theme) {
+    lv_coord_t cx = w / 2, cy = h / 2;
 
     // Outer glow ring
-    lv_obj_t *glowRing = lv_obj_create(bg);
-    lv_obj_set_size(glowRing, 230, 230);
-    lv_obj_align(glowRing, LV_ALIGN_CENTER, 0, -10);
-    lv_obj_set_style_bg_opa(glowRing, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_radius(glowRing, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_border_color(glowRing, theme.accent, 0);
-    lv_obj_set_style_border_width(glowRing, 2, 0);
-    lv_obj_set_style_border_opa(glowRing, LV_OPA_30, 0);
-    lv_obj_set_style_shadow_width(glowRing, 40, 0);
-    lv_obj_set_style_shadow_color(glowRing, theme.accent, 0);
-    lv_obj_set_style_shadow_opa(glowRing, LV_OPA_20, 0);
-    disableAllScrolling(glowRing);
+    lv_draw_rect_dsc_t ring;
+    lv_draw_rect_dsc_init(&ring);
+    ring.radius = LV_RADIUS_CIRCLE;
+    ring.bg_opa = LV_OPA_TRANSP;
+    ring.border_color = theme.accent;
+    ring.border_width = 2;
+    ring.border_opa = LV_OPA_30;
+    ring.shadow_width = 40;
+    ring.shadow_color = theme.accent;
+    ring.shadow_opa = LV_OPA_20;
+    lv_canvas_draw_rect(canvas, cx - 115, cy - 115, 230, 230, &ring);
 
     // Main clock face
-    lv_obj_t *face = lv_obj_create(bg);
-    lv_obj_set_size(face, 210, 210);
-    lv_obj_align(face, LV_ALIGN_CENTER, 0, -10);
-    lv_obj_set_style_bg_color(face, lv_color_hex(0x1A1A1A), 0);
-    lv_obj_set_style_bg_grad_color(face, lv_color_hex(0x0D0D0D), 0);
-    lv_obj_set_style_bg_grad_dir(face, LV_GRAD_DIR_VER, 0);
-    lv_obj_set_style_radius(face, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_border_color(face, lv_color_hex(0x333333), 0);
-    lv_obj_set_style_border_width(face, 1, 0);
-    lv_obj_set_style_shadow_width(face, 25, 0);
-    lv_obj_set_style_shadow_color(face, lv_color_hex(0x000000), 0);
-    lv_obj_set_style_shadow_opa(face, LV_OPA_80, 0);
-    disableAllScrolling(face);
+    lv_draw_rect_dsc_t face;
+    lv_draw_rect_dsc_init(&face);
+    face.radius = LV_RADIUS_CIRCLE;
+    face.bg_color = lv_color_hex(0x1A1A1A);
+    face.bg_grad.dir = LV_GRAD_DIR_VER;
+    face.bg_grad.stops_count = 2;
+    face.bg_grad.stops[0].color = lv_color_hex(0x1A1A1A);
+    face.bg_grad.stops[0].frac = 0;
+    face.bg_grad.stops[1].color = lv_color_hex(0x0D0D0D);
+    face.bg_grad.stops[1].frac = 255;
+    face.border_color = lv_color_hex(0x333333);
+    face.border_width = 1;
+    face.shadow_width = 25;
+    face.shadow_color = lv_color_hex(0x000000);
+    face.shadow_opa = LV_OPA_80;
+    lv_canvas_draw_rect(canvas, cx - 105, cy - 105, 210, 210, &face);
 
     // Hour markers with numbers for 12, 3, 6, 9
     const char* hourNums[] = {"12", "3", "6", "9"};
-    int numPositions[] = {0, 3, 6, 9};
-
     for (int i = 0; i < 12; i++) {
-        float angle = i * 30.0 * 3.14159 / 180.0;
-        int r = 88;
-        int x = sin(angle) * r;
-        int y = -cos(angle) * r;
-    
-        if (i == 0 || i == 3 || i == 6 || i == 9) {
-            // Number markers for 12, 3, 6, 9
-            lv_obj_t *numLabel = lv_label_create(face);
-            int idx = (i == 0) ? 0 : (i == 3) ? 1 : (i == 6) ? 2 : 3;
-            lv_label_set_text(numLabel, hourNums[idx]);
-            lv_obj_set_style_text_color(numLabel, theme.text, 0);
-            lv_obj_set_style_text_font(numLabel, &lv_font_montserrat_18, 0);
-            lv_obj_align(numLabel, LV_ALIGN_CENTER, x, y);
+        lv_coord_t x = cx + dialDX(i * 30, 88);
+        lv_coord_t y = cy + dialDY(i * 30, 88);
+        if (i % 3 == 0) {
+            canvasTextCentered(canvas, x, y, hourNums[i / 3], &lv_font_montserrat_18, theme.text);
         } else {
-            // Dot markers for other hours
-            lv_obj_t *marker = lv_obj_create(face);
-            lv_obj_set_size(marker, 6, 6);
-            lv_obj_align(marker, LV_ALIGN_CENTER, x, y);
-            lv_obj_set_style_bg_color(marker, lv_color_hex(0x4A4A4A), 0);
-            lv_obj_set_style_radius(marker, LV_RADIUS_CIRCLE, 0);
-            lv_obj_set_style_border_width(marker, 0, 0);
+            canvasDot(canvas, x, y, 6, lv_color_hex(0x4A4A4A));
         }
     }
 
     // Minute tick marks (60 ticks)
     for (int i = 0; i < 60; i++) {
         if (i % 5 == 0) continue; // Skip hour positions
-        float angle = i * 6.0 * 3.14159 / 180.0;
-        int r = 98;
-        int x = sin(angle) * r;
-        int y = -cos(angle) * r;
-    
-        lv_obj_t *tick = lv_obj_create(face);
-        lv_obj_set_size(tick, 2, 2);
-        lv_obj_align(tick, LV_ALIGN_CENTER, x, y);
-        lv_obj_set_style_bg_color(tick, lv_color_hex(0x2A2A2A), 0);
-        lv_obj_set_style_radius(tick, LV_RADIUS_CIRCLE, 0);
-        lv_obj_set_style_border_width(tick, 0, 0);
+        canvasDot(canvas, cx + dialDX(i * 6, 98), cy + dialDY(i * 6, 98), 2, lv_color_hex(0x2A2A2A));
+    }
+}
+
+void createAnalogClockCard() {
+    GradientTheme &theme = gradientThemes[userData.themeIndex];
+
+    // Full screen dark background
+    lv_obj_t *bg = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(bg, LCD_WIDTH, LCD_HEIGHT);
+    lv_obj_align(bg, LV_ALIGN_CENTER, 0, 0);
+    lv_obj_set_style_bg_color(bg, lv_color_hex(0x0A0A0A), 0);
+    lv_obj_set_style_radius(bg, 0, 0);
+    lv_obj_set_style_border_width(bg, 0, 0);
+    disableAllScrolling(bg);
+
+    // Static face artwork, painted once per theme
+    const lv_img_dsc_t *dialImg = getDialImage(analogDial, ANALOG_DIAL_SIZE, ANALOG_DIAL_SIZE, paintAnalogDial);
+    if (dialImg != NULL) {
+        lv_obj_t *dial = lv_img_create(bg);
+        lv_img_set_src(dial, dialImg);
+        lv_obj_align(dial, LV_ALIGN_CENTER, 0, -10);
     }
 
+    // Transparent frame the hands and jewel pivot in
+    lv_obj_t *face = lv_obj_create(bg);
+    lv_obj_remove_style_all(face);
+    lv_obj_set_size(face, 210, 210);
+    lv_obj_align(face, LV_ALIGN_CENTER, 0, -10);
+    disableAllScrolling(face);
+
     RTC_DateTime dt = rtc.getDateTime();
-    float hourAngle = ((dt.getHour() % 12) + dt.getMinute() / 60.0) * 30.0;
-    float minAngle = dt.getMinute() * 6.0;
-    float secAngle = dt.getSecond() * 6.0;
+    int hLen = 50, mLen = 72, sLen = 80;
 
     // Hour hand - thick and short
-    float hRad = hourAngle * 3.14159 / 180.0;
-    int hLen = 50;
-    int hx = sin(hRad) * hLen;
-    int hy = -cos(hRad) * hLen;
-
     lv_obj_t *hHand = lv_obj_create(face);
+    analogHourHand = hHand;
     lv_obj_set_size(hHand, 8, hLen + 15);
-    lv_obj_align(hHand, LV_ALIGN_CENTER, hx/2, hy/2);
+    lv_obj_align(hHand, LV_ALIGN_CENTER, 0, 0);
     lv_obj_set_style_bg_color(hHand, theme.text, 0);
     lv_obj_set_style_radius(hHand, 4, 0);
     lv_obj_set_style_border_width(hHand, 0, 0);
@@ -2849,14 +4193,10 @@ void createAnalogClockCard() {
     lv_obj_set_style_shadow_opa(hHand, LV_OPA_50, 0);
 
     // Minute hand - thinner and longer
-    float mRad = minAngle * 3.14159 / 180.0;
-    int mLen = 72;
-    int mx = sin(mRad) * mLen;
-    int my = -cos(mRad) * mLen;
-
     lv_obj_t *mHand = lv_obj_create(face);
+    analogMinHand = mHand;
     lv_obj_set_size(mHand, 5, mLen + 15);
-    lv_obj_align(mHand, LV_ALIGN_CENTER, mx/2, my/2);
+    lv_obj_align(mHand, LV_ALIGN_CENTER, 0, 0);
     lv_obj_set_style_bg_color(mHand, lv_color_hex(0xCCCCCC), 0);
     lv_obj_set_style_radius(mHand, 3, 0);
     lv_obj_set_style_border_width(mHand, 0, 0);
@@ -2865,18 +4205,18 @@ void createAnalogClockCard() {
     lv_obj_set_style_shadow_opa(mHand, LV_OPA_40, 0);
 
     // Second hand - thin red
-    float sRad = secAngle * 3.14159 / 180.0;
-    int sLen = 80;
-    int sx = sin(sRad) * sLen;
-    int sy = -cos(sRad) * sLen;
-
     lv_obj_t *sHand = lv_obj_create(face);
+    analogSecHand = sHand;
     lv_obj_set_size(sHand, 2, sLen + 20);
-    lv_obj_align(sHand, LV_ALIGN_CENTER, sx/2, sy/2);
+    lv_obj_align(sHand, LV_ALIGN_CENTER, 0, 0);
     lv_obj_set_style_bg_color(sHand, theme.accent, 0);
     lv_obj_set_style_radius(sHand, 1, 0);
     lv_obj_set_style_border_width(sHand, 0, 0);
 
+    placeAnalogHand(hHand, (dt.getHour() % 12) * 30 + dt.getMinute() / 2, hLen);
+    placeAnalogHand(mHand, dt.getMinute() * 6, mLen);
+    placeAnalogHand(sHand, dt.getSecond() * 6, sLen);
+
     // Center jewel
     lv_obj_t *centerOuter = lv_obj_create(face);
     lv_obj_set_size(centerOuter, 20, 20);
@@ -2895,8 +4235,7 @@ void createAnalogClockCard() {
 
     // Date window at bottom
     char dateBuf[12];
-    const char* monthShort[] = {"JAN", "FEB", "MAR", "APR", "MAY", "JUN", "JUL", "AUG", "SEP", "OCT", "NOV", "DEC"};
-    snprintf(dateBuf, sizeof(dateBuf), "%s %d", monthShort[dt.getMonth()-1], dt.getDay());
+    snprintf(dateBuf, sizeof(dateBuf), "%s %d", analogMonthShort[dt.getMonth()-1], dt.getDay());
 
     lv_obj_t *dateBox = lv_obj_create(bg);
     lv_obj_set_size(dateBox, 70, 26);
@@ -2908,15 +4247,43 @@ void createAnalogClockCard() {
     disableAllScrolling(dateBox);
 
     lv_obj_t *dateLabel = lv_label_create(dateBox);
+    analogDateLbl = dateLabel;
     lv_label_set_text(dateLabel, dateBuf);
     lv_obj_set_style_text_color(dateLabel, theme.accent, 0);
     lv_obj_set_style_text_font(dateLabel, &lv_font_montserrat_12, 0);
     lv_obj_align(dateLabel, LV_ALIGN_CENTER, 0, 0);
+
+    setCardUpdateHook(updateAnalogClockCard);
+}
+
+bool updateAnalogClockCard() {
+    RTC_DateTime dt = rtc.getDateTime();
+    placeAnalogHand(analogHourHand, (dt.getHour() % 12) * 30 + dt.getMinute() / 2, 50);
+    placeAnalogHand(analogMinHand, dt.getMinute() * 6, 72);
+    placeAnalogHand(analogSecHand, dt.getSecond() * 6, 80);
+
+    char dateBuf[12];
+    snprintf(dateBuf, sizeof(dateBuf), "%s %d", analogMonthShort[dt.getMonth()-1], dt.getDay());
+    setLabelTextIfChanged(analogDateLbl, dateBuf);
+    return true;
 }
 
 // 
 //  WORLD CLOCK CARD - Shows time for different timezone
 // 
+// Live widgets for updateWorldClockCard()
+static lv_obj_t *worldTimeLbl = NULL, *worldAmPmLbl = NULL;
+static int worldClockUtcOffset = 0;
+static bool worldClockIsDay = false;
+
+// Hour in the target zone (device assumed to be UTC+10, see below)
+static int worldClockHour(int utcOffset, int localHour) {
+    int worldHour = localHour + (utcOffset - 10);
+    if (worldHour >= 24) worldHour -= 24;
+    else if (worldHour < 0) worldHour += 24;
+    return worldHour;
+}
+
 void createWorldClockCard(int utcOffset, const char* country, const char* city) {
     GradientTheme &theme = gradientThemes[userData.themeIndex];
 
@@ -3026,6 +4393,7 @@ void createWorldClockCard(int utcOffset, const char* country, const char* city)
     snprintf(timeBuf, sizeof(timeBuf), "%02d:%02d", worldHour, dt.getMinute());
 
     lv_obj_t *timeLabel = lv_label_create(dayNightCircle);
+    worldTimeLbl = timeLabel;
     lv_label_set_text(timeLabel, timeBuf);
     lv_obj_set_style_text_color(timeLabel, theme.text, 0);
     lv_obj_set_style_text_font(timeLabel, &lv_font_montserrat_36, 0);
@@ -3034,6 +4402,7 @@ void createWorldClockCard(int utcOffset, const char* country, const char* city)
     // AM/PM indicator
     const char* ampm = (worldHour < 12) ? "AM" : "PM";
     lv_obj_t *ampmLabel = lv_label_create(dayNightCircle);
+    worldAmPmLbl = ampmLabel;
     lv_label_set_text(ampmLabel, ampm);
     lv_obj_set_style_text_color(ampmLabel, lv_color_hex(0x8E8E93), 0);
     lv_obj_set_style_text_font(ampmLabel, &lv_font_montserrat_14, 0);
@@ -3064,11 +4433,127 @@ void createWorldClockCard(int utcOffset, const char* country, const char* city)
     lv_obj_set_style_text_color(diffLabel, lv_color_hex(0x636366), 0);
     lv_obj_set_style_text_font(diffLabel, &lv_font_montserrat_12, 0);
     lv_obj_align(diffLabel, LV_ALIGN_BOTTOM_MID, 0, -35);
+
+    worldClockUtcOffset = utcOffset;
+    worldClockIsDay = isDay;
+    setCardUpdateHook(updateWorldClockCard);
+}
+
+bool updateWorldClockCard() {
+    RTC_DateTime dt = rtc.getDateTime();
+    int worldHour = worldClockHour(worldClockUtcOffset, dt.getHour());
+
+    // Day/night flip recolours the whole dial - let navigateTo() rebuild it
+    bool isDay = (worldHour >= 6 && worldHour < 18);
+    if (isDay != worldClockIsDay) return false;
+
+    char timeBuf[10];
+    snprintf(timeBuf, sizeof(timeBuf), "%02d:%02d", worldHour, dt.getMinute());
+    setLabelTextIfChanged(worldTimeLbl, timeBuf);
+    setLabelTextIfChanged(worldAmPmLbl, (worldHour < 12) ? "AM" : "PM");
+    return true;
 }
 
 // 
 //  COMPASS CARD - Apple Watch Style with Sunrise/Sunset
 // 
+// Live widgets for updateCompassCard(). Both sunrise/sunset hand pairs keep
+// their own point arrays since lv_line only stores a pointer to them.
+static lv_obj_t *compassHeadingLbl = NULL;
+static lv_obj_t *compassSunriseHand = NULL, *compassSunsetHand = NULL;
+static lv_obj_t *compassSunriseHand2 = NULL, *compassSunsetHand2 = NULL;
+static lv_point_t compassSunrisePts[2], compassSunsetPts[2];
+static lv_point_t compassSunrisePts2[2], compassSunsetPts2[2];
+static int compassCenterX = 0, compassCenterY = 0, compassRadiusPx = 0;
+static bool compassSunValid = false;
+static char compassSunriseShown[6] = "", compassSunsetShown[6] = "";
+
+// Move a centre-anchored hand to a new azimuth, invalidating only if it moved
+static void aimCompassHand(lv_obj_t *hand, lv_point_t *pts, float azimuth, float heading, int len) {
+    if (hand == NULL) return;
+    int deg = (int)lroundf(azimuth - heading);
+    lv_coord_t x = compassCenterX + dialDX(deg, len);
+    lv_coord_t y = compassCenterY + dialDY(deg, len);
+    if (pts[1].x == x && pts[1].y == y) return;
+    lv_obj_invalidate(hand);
+    pts[1].x = x;
+    pts[1].y = y;
+    lv_line_set_points(hand, pts, 2);
+}
+
+// Ring, 60 ticks and both cardinal letter sets. The layer is full width and
+// tall enough for the letters outside the ring; its centre is the compass centre.
+static int compassDialRadius() { return (LCD_WIDTH < 400) ? 140 : 160; }
+static lv_coord_t compassDialHeight() { return compassDialRadius() * 2 + 100; }
+
+static void paintCompassDial(lv_obj_t *canvas, lv_coord_t w, lv_coord_t h, GradientTheme &theme) {
+    lv_coord_t cx = w / 2, cy = h / 2;
+    int compassRadius = compassDialRadius();
+
+    // Outer compass ring with glow
+    lv_draw_rect_dsc_t ring;
+    lv_draw_rect_dsc_init(&ring);
+    ring.radius = LV_RADIUS_CIRCLE;
+    ring.bg_opa = LV_OPA_TRANSP;
+    ring.border_width = 2;
+    ring.border_color = lv_color_hex(0x48484A);
+    ring.border_opa = LV_OPA_30;
+    ring.shadow_width = 20;
+    ring.shadow_color = lv_color_hex(0x0A84FF);
+    ring.shadow_opa = LV_OPA_20;
+    lv_canvas_draw_rect(canvas, cx - compassRadius - 10, cy - compassRadius - 10,
+                        compassRadius * 2 + 20, compassRadius * 2 + 20, &ring);
+
+    // Draw enhanced compass markings
+    for (int i = 0; i < 60; i++) {
+        bool isCardinal = (i % 15 == 0);
+        bool isMajor = (i % 5 == 0);
+
+        int tickLen = isCardinal ? 15 : (isMajor ? 10 : 6);
+        lv_draw_line_dsc_t line;
+        lv_draw_line_dsc_init(&line);
+        line.width = isCardinal ? 3 : (isMajor ? 2 : 1);
+        line.color = lv_color_hex(isCardinal ? 0xFFFFFF : (isMajor ? 0x8E8E93 : 0x48484A));
+        line.round_start = 1;
+        line.round_end = 1;
+
+        lv_point_t points[2];
+        points[0].x = cx + dialDX(i * 6, compassRadius - tickLen);
+        points[0].y = cy + dialDY(i * 6, compassRadius - tickLen);
+        points[1].x = cx + dialDX(i * 6, compassRadius);
+        points[1].y = cy + dialDY(i * 6, compassRadius);
+        lv_canvas_draw_line(canvas, points, 2, &line);
+    }
+
+    // Cardinal directions; offsets are from the card centre, 20px below ours
+    const char* cardinals[] = {"N", "E", "S", "W"};
+    int positions[][2] = {{0, -compassRadius - 30}, {compassRadius + 20, 0},
+                          {0, compassRadius + 10}, {-compassRadius - 20, 0}};
+    int innerPositions[][2] = {{0, -compassRadius - 25}, {compassRadius + 15, 0},
+                               {0, compassRadius + 5}, {-compassRadius - 15, 0}};
+
+    for (int i = 0; i < 4; i++) {
+        lv_coord_t x = cx + positions[i][0];
+        lv_coord_t y = cy + 20 + positions[i][1];
+
+        // Add glow to North
+        if (i == 0) {
+            lv_point_t size;
+            lv_txt_get_size(&size, cardinals[i], &lv_font_montserrat_24, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+            lv_draw_rect_dsc_t glow;
+            lv_draw_rect_dsc_init(&glow);
+            glow.bg_opa = LV_OPA_TRANSP;
+            glow.shadow_width = 15;
+            glow.shadow_color = lv_color_hex(0x0A84FF);
+            glow.shadow_opa = LV_OPA_50;
+            lv_canvas_draw_rect(canvas, x - size.x / 2, y - size.y / 2, size.x, size.y, &glow);
+        }
+        canvasTextCentered(canvas, x, y, cardinals[i], &lv_font_montserrat_24, lv_color_hex(0xFFFFFF));
+        canvasTextCentered(canvas, cx + innerPositions[i][0], cy + 20 + innerPositions[i][1],
+                           cardinals[i], &lv_font_montserrat_20, lv_color_hex(0xFFFFFF));
+    }
+}
+
 void createCompassCard() {
     // PREMIUM: Compass + Sunrise/Sunset - Ultra polished design
     lv_obj_clean(lv_scr_act());
@@ -3089,64 +4574,17 @@ void createCompassCard() {
     // Compass parameters
     int centerX = LCD_WIDTH / 2;
     int centerY = (LCD_HEIGHT / 2) - 20;
-    int compassRadius = (LCD_WIDTH < 400) ? 140 : 160;
-
-    // Outer compass ring with glow
-    lv_obj_t *outerRing = lv_obj_create(card);
-    lv_obj_set_size(outerRing, compassRadius * 2 + 20, compassRadius * 2 + 20);
-    lv_obj_align(outerRing, LV_ALIGN_CENTER, 0, -20);
-    lv_obj_set_style_bg_opa(outerRing, LV_OPA_TRANSP, 0);
-    lv_obj_set_style_radius(outerRing, LV_RADIUS_CIRCLE, 0);
-    lv_obj_set_style_border_width(outerRing, 2, 0);
-    lv_obj_set_style_border_color(outerRing, lv_color_hex(0x48484A), 0);
-    lv_obj_set_style_border_opa(outerRing, LV_OPA_30, 0);
-    lv_obj_set_style_shadow_width(outerRing, 20, 0);
-    lv_obj_set_style_shadow_color(outerRing, lv_color_hex(0x0A84FF), 0);
-    lv_obj_set_style_shadow_opa(outerRing, LV_OPA_20, 0);
-
-    // Draw enhanced compass markings
-    for (int i = 0; i < 60; i++) {
-        float angle = (i * 6.0 - 90) * M_PI / 180.0;
-        bool isCardinal = (i % 15 == 0);
-        bool isMajor = (i % 5 == 0);
-    
-        int tickLen = isCardinal ? 15 : (isMajor ? 10 : 6);
-        int tickWidth = isCardinal ? 3 : (isMajor ? 2 : 1);
-        uint32_t tickColor = isCardinal ? 0xFFFFFF : (isMajor ? 0x8E8E93 : 0x48484A);
-    
-        int x1 = centerX + (compassRadius - tickLen) * cos(angle);
-        int y1 = centerY + (compassRadius - tickLen) * sin(angle);
-        int x2 = centerX + compassRadius * cos(angle);
-        int y2 = centerY + compassRadius * sin(angle);
-    
-        lv_obj_t *tick = lv_line_create(card);
-        static lv_point_t points[2];
-        points[0].x = x1; points[0].y = y1;
-        points[1].x = x2; points[1].y = y2;
-        lv_line_set_points(tick, points, 2);
-        lv_obj_set_style_line_width(tick, tickWidth, 0);
-        lv_obj_set_style_line_color(tick, lv_color_hex(tickColor), 0);
-        lv_obj_set_style_line_rounded(tick, true, 0);
-    }
-
-    // Cardinal directions with enhanced styling
-    const char* cardinals[] = {"N", "E", "S", "W"};
-    int positions[][2] = {{0, -compassRadius - 30}, {compassRadius + 20, 0}, 
-                          {0, compassRadius + 10}, {-compassRadius - 20, 0}};
+    int compassRadius = compassDialRadius();
+    compassCenterX = centerX;
+    compassCenterY = centerY;
+    compassRadiusPx = compassRadius;
 
-    for (int i = 0; i < 4; i++) {
-        lv_obj_t *cardLabel = lv_label_create(card);
-        lv_label_set_text(cardLabel, cardinals[i]);
-        lv_obj_set_style_text_color(cardLabel, lv_color_hex(0xFFFFFF), 0);
-        lv_obj_set_style_text_font(cardLabel, &lv_font_montserrat_24, 0);
-        lv_obj_align(cardLabel, LV_ALIGN_CENTER, positions[i][0], positions[i][1]);
-    
-        // Add glow to North
-        if (i == 0) {
-            lv_obj_set_style_shadow_width(cardLabel, 15, 0);
-            lv_obj_set_style_shadow_color(cardLabel, lv_color_hex(0x0A84FF), 0);
-            lv_obj_set_style_shadow_opa(cardLabel, LV_OPA_50, 0);
-        }
+    // Static ring, ticks and cardinals, painted once
+    const lv_img_dsc_t *dialImg = getDialImage(compassDial, LCD_WIDTH, compassDialHeight(), paintCompassDial);
+    if (dialImg != NULL) {
+        lv_obj_t *dial = lv_img_create(card);
+        lv_img_set_src(dial, dialImg);
+        lv_obj_align(dial, LV_ALIGN_CENTER, 0, -20);
     }
 
     // Sunrise/Sunset info with gradient text effect
@@ -3201,14 +4639,13 @@ void createCompassCard() {
         float calibratedHeading = getCalibratedHeading();
     
         // Blue hand for sunrise with glow
-        float sunriseAngle = (sunData.sunriseAzimuth - calibratedHeading - 90) * M_PI / 180.0;
         lv_obj_t *sunriseHand = lv_line_create(card);
-        static lv_point_t sunrisePts[2];
+        compassSunriseHand = sunriseHand;
+        lv_point_t *sunrisePts = compassSunrisePts;
         sunrisePts[0].x = centerX;
         sunrisePts[0].y = centerY;
-        sunrisePts[1].x = centerX + (compassRadius - 45) * cos(sunriseAngle);
-        sunrisePts[1].y = centerY + (compassRadius - 45) * sin(sunriseAngle);
-        lv_line_set_points(sunriseHand, sunrisePts, 2);
+        sunrisePts[1] = sunrisePts[0];
+        aimCompassHand(sunriseHand, sunrisePts, sunData.sunriseAzimuth, calibratedHeading, compassRadius - 45);
         lv_obj_set_style_line_width(sunriseHand, 6, 0);
         lv_obj_set_style_line_color(sunriseHand, lv_color_hex(0x52B2CF), 0);
         lv_obj_set_style_line_rounded(sunriseHand, true, 0);
@@ -3217,14 +4654,13 @@ void createCompassCard() {
         lv_obj_set_style_shadow_opa(sunriseHand, LV_OPA_60, 0);
 
         // Red hand for sunset with glow
-        float sunsetAngle = (sunData.sunsetAzimuth - calibratedHeading - 90) * M_PI / 180.0;
         lv_obj_t *sunsetHand = lv_line_create(card);
-        static lv_point_t sunsetPts[2];
+        compassSunsetHand = sunsetHand;
+        lv_point_t *sunsetPts = compassSunsetPts;
         sunsetPts[0].x = centerX;
         sunsetPts[0].y = centerY;
-        sunsetPts[1].x = centerX + (compassRadius - 45) * cos(sunsetAngle);
-        sunsetPts[1].y = centerY + (compassRadius - 45) * sin(sunsetAngle);
-        lv_line_set_points(sunsetHand, sunsetPts, 2);
+        sunsetPts[1] = sunsetPts[0];
+        aimCompassHand(sunsetHand, sunsetPts, sunData.sunsetAzimuth, calibratedHeading, compassRadius - 45);
         lv_obj_set_style_line_width(sunsetHand, 6, 0);
         lv_obj_set_style_line_color(sunsetHand, lv_color_hex(0xFF6B35), 0);
         lv_obj_set_style_line_rounded(sunsetHand, true, 0);
@@ -3283,6 +4719,7 @@ void createCompassCard() {
     lv_obj_set_style_border_color(headingBadge, lv_color_hex(0x48484A), 0);
 
     lv_obj_t *headingLabel = lv_label_create(headingBadge);
+    compassHeadingLbl = headingLabel;
     char headingStr[16];
     snprintf(headingStr, sizeof(headingStr), "%.0f", getCalibratedHeading());
     lv_label_set_text(headingLabel, headingStr);
@@ -3290,31 +4727,6 @@ void createCompassCard() {
     lv_obj_set_style_text_font(headingLabel, &lv_font_montserrat_16, 0);
     lv_obj_center(headingLabel);
 
-    // Cardinal directions
-    lv_obj_t *north = lv_label_create(card);
-    lv_label_set_text(north, "N");
-    lv_obj_set_style_text_color(north, lv_color_hex(0xFFFFFF), 0);
-    lv_obj_set_style_text_font(north, &lv_font_montserrat_20, 0);
-    lv_obj_align(north, LV_ALIGN_CENTER, 0, -compassRadius - 25);
-
-    lv_obj_t *south = lv_label_create(card);
-    lv_label_set_text(south, "S");
-    lv_obj_set_style_text_color(south, lv_color_hex(0xFFFFFF), 0);
-    lv_obj_set_style_text_font(south, &lv_font_montserrat_20, 0);
-    lv_obj_align(south, LV_ALIGN_CENTER, 0, compassRadius + 5);
-
-    lv_obj_t *east = lv_label_create(card);
-    lv_label_set_text(east, "E");
-    lv_obj_set_style_text_color(east, lv_color_hex(0xFFFFFF), 0);
-    lv_obj_set_style_text_font(east, &lv_font_montserrat_20, 0);
-    lv_obj_align(east, LV_ALIGN_CENTER, compassRadius + 15, 0);
-
-    lv_obj_t *west = lv_label_create(card);
-    lv_label_set_text(west, "W");
-    lv_obj_set_style_text_color(west, lv_color_hex(0xFFFFFF), 0);
-    lv_obj_set_style_text_font(west, &lv_font_montserrat_20, 0);
-    lv_obj_align(west, LV_ALIGN_CENTER, -compassRadius - 15, 0);
-
     // Sunrise time with gradient (blue to orange)
     if (sunData.valid) {
         lv_obj_t *sunriseLabel = lv_label_create(card);
@@ -3346,29 +4758,52 @@ void createCompassCard() {
         float calibratedHeading = getCalibratedHeading();
     
         // Blue hand for sunrise (pointing to sunrise azimuth)
-        float sunriseAngle = (sunData.sunriseAzimuth - calibratedHeading - 90) * M_PI / 180.0;
         lv_obj_t *sunriseHand = lv_line_create(card);
-        static lv_point_t sunrisePts[2];
+        compassSunriseHand2 = sunriseHand;
+        lv_point_t *sunrisePts = compassSunrisePts2;
         sunrisePts[0].x = centerX;
         sunrisePts[0].y = centerY;
-        sunrisePts[1].x = centerX + (compassRadius - 40) * cos(sunriseAngle);
-        sunrisePts[1].y = centerY + (compassRadius - 40) * sin(sunriseAngle);
-        lv_line_set_points(sunriseHand, sunrisePts, 2);
+        sunrisePts[1] = sunrisePts[0];
+        aimCompassHand(sunriseHand, sunrisePts, sunData.sunriseAzimuth, calibratedHeading, compassRadius - 40);
         lv_obj_set_style_line_width(sunriseHand, 4, 0);
         lv_obj_set_style_line_color(sunriseHand, lv_color_hex(0x0A84FF), 0);  // Blue
 
         // Red hand for sunset (pointing to sunset azimuth)
-        float sunsetAngle = (sunData.sunsetAzimuth - calibratedHeading - 90) * M_PI / 180.0;
         lv_obj_t *sunsetHand = lv_line_create(card);
-        static lv_point_t sunsetPts[2];
+        compassSunsetHand2 = sunsetHand;
+        lv_point_t *sunsetPts = compassSunsetPts2;
         sunsetPts[0].x = centerX;
         sunsetPts[0].y = centerY;
-        sunsetPts[1].x = centerX + (compassRadius - 40) * cos(sunsetAngle);
-        sunsetPts[1].y = centerY + (compassRadius - 40) * sin(sunsetAngle);
-        lv_line_set_points(sunsetHand, sunsetPts, 2);
+        sunsetPts[1] = sunsetPts[0];
+        aimCompassHand(sunsetHand, sunsetPts, sunData.sunsetAzimuth, calibratedHeading, compassRadius - 40);
         lv_obj_set_style_line_width(sunsetHand, 4, 0);
         lv_obj_set_style_line_color(sunsetHand, lv_color_hex(0xFF3B30), 0);  // Red
     }
+
+    compassSunValid = sunData.valid;
+    strncpy(compassSunriseShown, sunData.sunriseTime, sizeof(compassSunriseShown));
+    strncpy(compassSunsetShown, sunData.sunsetTime, sizeof(compassSunsetShown));
+    setCardUpdateHook(updateCompassCard);
+}
+
+bool updateCompassCard() {
+    // Sunrise/sunset boxes appear (or change) once data arrives - needs a rebuild
+    if (sunData.valid != compassSunValid) return false;
+    if (strncmp(sunData.sunriseTime, compassSunriseShown, sizeof(compassSunriseShown)) != 0 ||
+        strncmp(sunData.sunsetTime, compassSunsetShown, sizeof(compassSunsetShown)) != 0) return false;
+
+    float heading = getCalibratedHeading();
+    char headingStr[16];
+    snprintf(headingStr, sizeof(headingStr), "%.0f", heading);
+    setLabelTextIfChanged(compassHeadingLbl, headingStr);
+
+    if (compassSunValid) {
+        aimCompassHand(compassSunriseHand, compassSunrisePts, sunData.sunriseAzimuth, heading, compassRadiusPx - 45);
+        aimCompassHand(compassSunsetHand, compassSunsetPts, sunData.sunsetAzimuth, heading, compassRadiusPx - 45);
+        aimCompassHand(compassSunriseHand2, compassSunrisePts2, sunData.sunriseAzimuth, heading, compassRadiusPx - 40);
+        aimCompassHand(compassSunsetHand2, compassSunsetPts2, sunData.sunsetAzimuth, heading, compassRadiusPx - 40);
+    }
+    return true;
 }
 
 // 
@@ -4082,6 +5517,14 @@ void blackjackStandCb(lv_event_t *e) {
 // 
 void dinoJumpCb(lv_event_t *e);
 
+// Live widgets for updateDinoCard()
+static lv_obj_t *dinoLvlLbl = NULL, *dinoScoreLbl = NULL;
+static lv_obj_t *dinoParts[5] = {NULL};       // Body, head, eye, leg1, leg2
+static const int dinoPartBaseY[5] = {-38, -75, -82, -38, -38};
+static lv_obj_t *dinoCactusParts[3] = {NULL}; // Trunk, left arm, right arm
+static const int dinoCactusOffsetX[3] = {0, -8, 16};
+static bool dinoCardGameOver = false;
+
 void createDinoCard() {
     // Dark card with pixel game aesthetic
     lv_obj_t *card = lv_obj_create(lv_scr_act());
@@ -4108,6 +5551,7 @@ void createDinoCard() {
     int level = dinoScore / 50 + 1;
     snprintf(lvlBuf, sizeof(lvlBuf), "%d lvl", level);
     lv_obj_t *lvlLbl = lv_label_create(lvlBadge);
+    dinoLvlLbl = lvlLbl;
     lv_label_set_text(lvlLbl, lvlBuf);
     lv_obj_set_style_text_color(lvlLbl, lv_color_hex(0x8E8E93), 0);
     lv_obj_set_style_text_font(lvlLbl, &lv_font_montserrat_12, 0);
@@ -4126,6 +5570,7 @@ void createDinoCard() {
     char sBuf[16];
     snprintf(sBuf, sizeof(sBuf), "%d", dinoScore);
     lv_obj_t *scoreLbl = lv_label_create(scoreBg);
+    dinoScoreLbl = scoreLbl;
     lv_label_set_text(scoreLbl, sBuf);
     lv_obj_set_style_text_color(scoreLbl, lv_color_hex(0x30D158), 0);
     lv_obj_set_style_text_font(scoreLbl, &lv_font_montserrat_18, 0);
@@ -4188,6 +5633,12 @@ void createDinoCard() {
     lv_obj_set_style_radius(dinoLeg2, 0, 0);
     lv_obj_set_style_border_width(dinoLeg2, 0, 0);
 
+    dinoParts[0] = dinoBody;
+    dinoParts[1] = dinoHead;
+    dinoParts[2] = dinoEye;
+    dinoParts[3] = dinoLeg1;
+    dinoParts[4] = dinoLeg2;
+
     // CACTUS OBSTACLE - Red/orange
     lv_obj_t *cactus = lv_obj_create(gameArea);
     lv_obj_set_size(cactus, 20, 45);
@@ -4211,6 +5662,10 @@ void createDinoCard() {
     lv_obj_set_style_radius(cactusArm2, 2, 0);
     lv_obj_set_style_border_width(cactusArm2, 0, 0);
 
+    dinoCactusParts[0] = cactus;
+    dinoCactusParts[1] = cactusArm1;
+    dinoCactusParts[2] = cactusArm2;
+
     // Food items (like reference - coffee cup and croissant style icons)
     // Coffee cup icon
     lv_obj_t *coffee = lv_obj_create(gameArea);
@@ -4270,6 +5725,29 @@ void createDinoCard() {
         lv_obj_set_style_text_font(hsLbl, &lv_font_montserrat_14, 0);
         lv_obj_align(hsLbl, LV_ALIGN_CENTER, 0, 15);
     }
+
+    dinoCardGameOver = dinoGameOver;
+    setCardUpdateHook(updateDinoCard);
+}
+
+bool updateDinoCard() {
+    // Game over overlay and button style change the layout - rebuild once
+    if (dinoGameOver != dinoCardGameOver) return false;
+
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%d lvl", dinoScore / 50 + 1);
+    setLabelTextIfChanged(dinoLvlLbl, buf);
+    snprintf(buf, sizeof(buf), "%d", dinoScore);
+    setLabelTextIfChanged(dinoScoreLbl, buf);
+
+    // lv_obj_set_x/y are no-ops when the offset is unchanged
+    for (int i = 0; i < 5; i++) {
+        lv_obj_set_y(dinoParts[i], dinoPartBaseY[i] + dinoY);
+    }
+    for (int i = 0; i < 3; i++) {
+        lv_obj_set_x(dinoCactusParts[i], obstacleX + dinoCactusOffsetX[i]);
+    }
+    return true;
 }
 
 void dinoJumpCb(lv_event_t *e) {
@@ -4633,6 +6111,9 @@ void createForecastCard() {
 // 
 void musicPlayCb(lv_event_t *e);
 
+// Live widgets for updateMusicCard()
+static lv_obj_t *musicProgFill = NULL, *musicPlayIcon = NULL;
+
 void createMusicCard() {
     lv_obj_t *card = lv_obj_create(lv_scr_act());
     lv_obj_set_size(card, LCD_WIDTH, LCD_HEIGHT);
@@ -4685,6 +6166,7 @@ void createMusicCard() {
 
     int fillWidth = ((LCD_WIDTH - 84) * musicCurrent) / musicDuration;
     lv_obj_t *progFill = lv_obj_create(progBg);
+    musicProgFill = progFill;
     lv_obj_set_size(progFill, fillWidth, 4);
     lv_obj_align(progFill, LV_ALIGN_LEFT_MID, 1, 0);
     lv_obj_set_style_bg_color(progFill, lv_color_hex(0xFFFFFF), 0);
@@ -4700,17 +6182,25 @@ void createMusicCard() {
     lv_obj_add_event_cb(playBtn, musicPlayCb, LV_EVENT_CLICKED, NULL);
 
     lv_obj_t *playIcon = lv_label_create(playBtn);
+    musicPlayIcon = playIcon;
     lv_label_set_text(playIcon, musicPlaying ? LV_SYMBOL_PAUSE : LV_SYMBOL_PLAY);
     lv_obj_set_style_text_color(playIcon, lv_color_hex(0x000000), 0);
     lv_obj_set_style_text_font(playIcon, &lv_font_montserrat_24, 0);
     lv_obj_center(playIcon);
 
     // Mini status bar removed
+    setCardUpdateHook(updateMusicCard);
+}
+
+bool updateMusicCard() {
+    lv_obj_set_width(musicProgFill, ((LCD_WIDTH - 84) * musicCurrent) / musicDuration);
+    setLabelTextIfChanged(musicPlayIcon, musicPlaying ? LV_SYMBOL_PAUSE : LV_SYMBOL_PLAY);
+    return true;
 }
 
 void musicPlayCb(lv_event_t *e) {
     musicPlaying = !musicPlaying;
-    navigateTo(CAT_MEDIA, 0);
+    refreshCurrentCard();
 }
 
 void createGalleryCard() {
@@ -4736,6 +6226,9 @@ void stopwatchToggleCb(lv_event_t *e);
 void stopwatchResetCb(lv_event_t *e);
 void breatheStartCb(lv_event_t *e);
 
+// Live widgets for updateSandTimerCard()
+static lv_obj_t *sandTimeLbl = NULL, *sandArc = NULL, *sandBtn = NULL, *sandBtnLbl = NULL;
+
 void createSandTimerCard() {
     GradientTheme &theme = gradientThemes[userData.themeIndex];
     lv_obj_t *card = createCard("SAND TIMER");
@@ -4751,6 +6244,7 @@ void createSandTimerCard() {
     snprintf(timeBuf, sizeof(timeBuf), "%d:%02d", mins, secs);
 
     lv_obj_t *timeLbl = lv_label_create(card);
+    sandTimeLbl = timeLbl;
     lv_label_set_text(timeLbl, timeBuf);
     lv_obj_set_style_text_color(timeLbl, theme.text, 0);
     lv_obj_set_style_text_font(timeLbl, &lv_font_montserrat_48, 0);
@@ -4758,6 +6252,7 @@ void createSandTimerCard() {
 
     // Progress arc
     lv_obj_t *arc = lv_arc_create(card);
+    sandArc = arc;
     lv_obj_set_size(arc, 180, 180);
     lv_obj_align(arc, LV_ALIGN_CENTER, 0, 20);
     lv_arc_set_rotation(arc, 270);
@@ -4772,6 +6267,7 @@ void createSandTimerCard() {
 
     // Start/Reset button
     lv_obj_t *btn = lv_btn_create(card);
+    sandBtn = btn;
     lv_obj_set_size(btn, 120, 45);
     lv_obj_align(btn, LV_ALIGN_BOTTOM_MID, 0, -20);
     lv_obj_set_style_bg_color(btn, sandTimerRunning ? lv_color_hex(0xFF453A) : theme.accent, 0);
@@ -4779,11 +6275,31 @@ void createSandTimerCard() {
     lv_obj_add_event_cb(btn, sandTimerStartCb, LV_EVENT_CLICKED, NULL);
 
     lv_obj_t *btnLbl = lv_label_create(btn);
+    sandBtnLbl = btnLbl;
     lv_label_set_text(btnLbl, sandTimerRunning ? "RESET" : "START");
     lv_obj_set_style_text_color(btnLbl, lv_color_hex(0xFFFFFF), 0);
     lv_obj_center(btnLbl);
 
     // Mini status bar removed
+    setCardUpdateHook(updateSandTimerCard);
+}
+
+bool updateSandTimerCard() {
+    GradientTheme &theme = gradientThemes[userData.themeIndex];
+
+    unsigned long elapsed = sandTimerRunning ? (millis() - sandTimerStartMs) : 0;
+    unsigned long remaining = SAND_TIMER_DURATION > elapsed ? SAND_TIMER_DURATION - elapsed : 0;
+    int progress = sandTimerRunning ? ((SAND_TIMER_DURATION - remaining) * 100) / SAND_TIMER_DURATION : 0;
+
+    char timeBuf[16];
+    snprintf(timeBuf, sizeof(timeBuf), "%d:%02d", (int)(remaining / 60000), (int)((remaining % 60000) / 1000));
+    setLabelTextIfChanged(sandTimeLbl, timeBuf);
+
+    if (lv_arc_get_value(sandArc) != progress) lv_arc_set_value(sandArc, progress);
+
+    setBgColorIfChanged(sandBtn, sandTimerRunning ? lv_color_hex(0xFF453A) : theme.accent);
+    setLabelTextIfChanged(sandBtnLbl, sandTimerRunning ? "RESET" : "START");
+    return true;
 }
 
 void sandTimerStartCb(lv_event_t *e) {
@@ -4793,22 +6309,29 @@ void sandTimerStartCb(lv_event_t *e) {
         sandTimerRunning = true;
         sandTimerStartMs = millis();
     }
-    navigateTo(CAT_TIMER, 0);
+    refreshCurrentCard();
 }
 
-void createStopwatchCard() {
-    GradientTheme &theme = gradientThemes[userData.themeIndex];
-    lv_obj_t *card = createCard("STOPWATCH");
+// Live widgets for updateStopwatchCard()
+static lv_obj_t *stopwatchTimeLbl = NULL, *stopwatchPlayBtn = NULL, *stopwatchPlayLbl = NULL;
 
+static void formatStopwatchTime(char *buf, size_t len) {
     unsigned long total = stopwatchRunning ? (stopwatchElapsedMs + millis() - stopwatchStartMs) : stopwatchElapsedMs;
     int mins = total / 60000;
     int secs = (total % 60000) / 1000;
     int ms = (total % 1000) / 10;
+    snprintf(buf, len, "%02d:%02d.%02d", mins, secs, ms);
+}
+
+void createStopwatchCard() {
+    GradientTheme &theme = gradientThemes[userData.themeIndex];
+    lv_obj_t *card = createCard("STOPWATCH");
 
     char timeBuf[16];
-    snprintf(timeBuf, sizeof(timeBuf), "%02d:%02d.%02d", mins, secs, ms);
+    formatStopwatchTime(timeBuf, sizeof(timeBuf));
 
     lv_obj_t *timeLbl = lv_label_create(card);
+    stopwatchTimeLbl = timeLbl;
     lv_label_set_text(timeLbl, timeBuf);
     lv_obj_set_style_text_color(timeLbl, theme.text, 0);
     lv_obj_set_style_text_font(timeLbl, &lv_font_montserrat_48, 0);
@@ -4816,6 +6339,7 @@ void createStopwatchCard() {
 
     // Play/Pause button
     lv_obj_t *playBtn = lv_btn_create(card);
+    stopwatchPlayBtn = playBtn;
     lv_obj_set_size(playBtn, 100, 45);
     lv_obj_align(playBtn, LV_ALIGN_BOTTOM_MID, -60, -20);
     lv_obj_set_style_bg_color(playBtn, stopwatchRunning ? lv_color_hex(0xFF9F0A) : lv_color_hex(0x30D158), 0);
@@ -4823,6 +6347,7 @@ void createStopwatchCard() {
     lv_obj_add_event_cb(playBtn, stopwatchToggleCb, LV_EVENT_CLICKED, NULL);
 
     lv_obj_t *playLbl = lv_label_create(playBtn);
+    stopwatchPlayLbl = playLbl;
     lv_label_set_text(playLbl, stopwatchRunning ? "PAUSE" : "START");
     lv_obj_set_style_text_color(playLbl, lv_color_hex(0xFFFFFF), 0);
     lv_obj_center(playLbl);
@@ -4841,6 +6366,17 @@ void createStopwatchCard() {
     lv_obj_center(resetLbl);
 
     // Mini status bar removed
+    setCardUpdateHook(updateStopwatchCard);
+}
+
+bool updateStopwatchCard() {
+    char timeBuf[16];
+    formatStopwatchTime(timeBuf, sizeof(timeBuf));
+    setLabelTextIfChanged(stopwatchTimeLbl, timeBuf);
+
+    setBgColorIfChanged(stopwatchPlayBtn, stopwatchRunning ? lv_color_hex(0xFF9F0A) : lv_color_hex(0x30D158));
+    setLabelTextIfChanged(stopwatchPlayLbl, stopwatchRunning ? "PAUSE" : "START");
+    return true;
 }
 
 void stopwatchToggleCb(lv_event_t *e) {
@@ -4852,13 +6388,13 @@ void stopwatchToggleCb(lv_event_t *e) {
         trackStopwatchUse();
         stopwatchStartMs = millis();
     }
-    navigateTo(CAT_TIMER, 1);
+    refreshCurrentCard();
 }
 
 void stopwatchResetCb(lv_event_t *e) {
     stopwatchRunning = false;
     stopwatchElapsedMs = 0;
-    navigateTo(CAT_TIMER, 1);
+    refreshCurrentCard();
 }
 
 void createCountdownCard() {
@@ -4887,14 +6423,29 @@ void createCountdownCard() {
     // Mini status bar removed
 }
 
-void createBreatheCard() {
-    GradientTheme &theme = gradientThemes[userData.themeIndex];
+// Live widgets for updateBreatheCard()
+static lv_obj_t *breatheCircle = NULL, *breathePhaseLbl = NULL, *breatheBtnLbl = NULL;
+static const char* breathePhases[] = {"Breathe In", "Hold", "Breathe Out", "Hold"};
 
-    lv_obj_t *card = lv_obj_create(lv_scr_act());
-    lv_obj_set_size(card, LCD_WIDTH, LCD_HEIGHT);
-    lv_obj_align(card, LV_ALIGN_CENTER, 0, 0);
-    lv_obj_set_style_bg_color(card, lv_color_hex(0x00A896), 0);
-    lv_obj_set_style_bg_grad_color(card, lv_color_hex(0x02C39A), 0);
+static int breatheCircleSize() {
+    int baseSize = 120;
+    int pulseAdd = breatheRunning ? (int)(40 * sin((millis() - breatheStartMs) / 2000.0 * 3.14159)) : 0;
+    return baseSize + pulseAdd;
+}
+
+static const char* breathePhaseText() {
+    int phaseIndex = breatheRunning ? ((millis() - breatheStartMs) / 4000) % 4 : 0;
+    return breatheRunning ? breathePhases[phaseIndex] : "Tap to Start";
+}
+
+void createBreatheCard() {
+    GradientTheme &theme = gradientThemes[userData.themeIndex];
+
+    lv_obj_t *card = lv_obj_create(lv_scr_act());
+    lv_obj_set_size(card, LCD_WIDTH, LCD_HEIGHT);
+    lv_obj_align(card, LV_ALIGN_CENTER, 0, 0);
+    lv_obj_set_style_bg_color(card, lv_color_hex(0x00A896), 0);
+    lv_obj_set_style_bg_grad_color(card, lv_color_hex(0x02C39A), 0);
     lv_obj_set_style_bg_grad_dir(card, LV_GRAD_DIR_VER, 0);
     lv_obj_set_style_radius(card, 0, 0);
     lv_obj_set_style_border_width(card, 0, 0);
@@ -4908,11 +6459,10 @@ void createBreatheCard() {
     lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 16);
 
     // Breathing circle
-    int baseSize = 120;
-    int pulseAdd = breatheRunning ? (int)(40 * sin((millis() - breatheStartMs) / 2000.0 * 3.14159)) : 0;
-    int circleSize = baseSize + pulseAdd;
+    int circleSize = breatheCircleSize();
 
     lv_obj_t *circle = lv_obj_create(card);
+    breatheCircle = circle;
     lv_obj_set_size(circle, circleSize, circleSize);
     lv_obj_align(circle, LV_ALIGN_CENTER, 0, 0);
     lv_obj_set_style_bg_color(circle, lv_color_hex(0xFFFFFF), 0);
@@ -4920,11 +6470,9 @@ void createBreatheCard() {
     lv_obj_set_style_radius(circle, LV_RADIUS_CIRCLE, 0);
     lv_obj_set_style_border_width(circle, 0, 0);
 
-    const char* phases[] = {"Breathe In", "Hold", "Breathe Out", "Hold"};
-    int phaseIndex = breatheRunning ? ((millis() - breatheStartMs) / 4000) % 4 : 0;
-
     lv_obj_t *phaseLbl = lv_label_create(circle);
-    lv_label_set_text(phaseLbl, breatheRunning ? phases[phaseIndex] : "Tap to Start");
+    breathePhaseLbl = phaseLbl;
+    lv_label_set_text(phaseLbl, breathePhaseText());
     lv_obj_set_style_text_color(phaseLbl, lv_color_hex(0xFFFFFF), 0);
     lv_obj_set_style_text_font(phaseLbl, &lv_font_montserrat_16, 0);
     lv_obj_center(phaseLbl);
@@ -4938,17 +6486,30 @@ void createBreatheCard() {
     lv_obj_add_event_cb(btn, breatheStartCb, LV_EVENT_CLICKED, NULL);
 
     lv_obj_t *btnLbl = lv_label_create(btn);
+    breatheBtnLbl = btnLbl;
     lv_label_set_text(btnLbl, breatheRunning ? "STOP" : "START");
     lv_obj_set_style_text_color(btnLbl, lv_color_hex(0x00A896), 0);
     lv_obj_center(btnLbl);
 
     // Mini status bar removed
+    setCardUpdateHook(updateBreatheCard);
+}
+
+bool updateBreatheCard() {
+    int circleSize = breatheCircleSize();
+    if (lv_obj_get_width(breatheCircle) != circleSize) {
+        // Phase label is centred inside the circle, so it follows on the next layout pass
+        lv_obj_set_size(breatheCircle, circleSize, circleSize);
+    }
+    setLabelTextIfChanged(breathePhaseLbl, breathePhaseText());
+    setLabelTextIfChanged(breatheBtnLbl, breatheRunning ? "STOP" : "START");
+    return true;
 }
 
 void breatheStartCb(lv_event_t *e) {
     breatheRunning = !breatheRunning;
     if (breatheRunning) breatheStartMs = millis();
-    navigateTo(CAT_TIMER, 3);
+    refreshCurrentCard();
 }
 
 // 
@@ -5247,7 +6808,7 @@ void themeChangeCb(lv_event_t *e) {
 void brightnessChangeCb(lv_event_t *e) {
     lv_obj_t *slider = lv_event_get_target(e);
     userData.brightness = lv_slider_get_value(slider);
-    if (!batterySaverMode) gfx->setBrightness(userData.brightness);
+    if (!batterySaverMode) displaySetBrightness(userData.brightness);
 }
 
 // 
@@ -5659,10 +7220,10 @@ void createTorchCard() {
 
     if (torchOn) {
         lv_obj_set_style_bg_color(card, lv_color_hex(torchColors[torchColorIndex]), 0);
-        gfx->setBrightness(torchBrightness);
+        displaySetBrightness(torchBrightness);
     } else {
         lv_obj_set_style_bg_color(card, lv_color_hex(0x0A0A0C), 0);
-        gfx->setBrightness(batterySaverMode ? 100 : userData.brightness);
+        displaySetBrightness(batterySaverMode ? 100 : userData.brightness);
     }
 
     lv_obj_set_style_bg_opa(card, LV_OPA_COVER, 0);
@@ -6438,30 +7999,23 @@ void createDailyChallengeCard() {
 // 
 //  STEP DETECTION
 // 
-float prevMag = 1.0, prevPrevMag = 1.0;
-unsigned long lastStepTime = 0;
+// Detection runs per-sample in sensor_task; this applies new steps to
+// userData from loop() so the saved counters only have one writer.
+uint32_t sensorStepsApplied = 0;
 
 void updateStepCount() {
     if (!hasIMU) return;
 
-    float currentMag = sqrt(acc.x * acc.x + acc.y * acc.y + acc.z * acc.z);
+    uint32_t newSteps = sensorStepsDetected - sensorStepsApplied;
+    if (newSteps == 0) return;
+    sensorStepsApplied += newSteps;
 
-    // Peak detection
-    if (prevMag > prevPrevMag && prevMag > currentMag && prevMag > 1.3) {
-        if (millis() - lastStepTime > 300) {  // Debounce
-            userData.steps++;
-            userData.totalDistance += 0.0007;  // ~0.7m per step
-            userData.totalCalories += 0.04;    // ~0.04 cal per step
-            lastStepTime = millis();
-        
-            // Update today's history
-            RTC_DateTime dt = rtc.getDateTime();
-            userData.stepHistory[dt.getWeek()] = userData.steps;
-        }
-    }
+    userData.steps += newSteps;
+    userData.totalDistance += 0.0007 * newSteps;  // ~0.7m per step
+    userData.totalCalories += 0.04 * newSteps;    // ~0.04 cal per step
 
-    prevPrevMag = prevMag;
-    prevMag = currentMag;
+    // Update today's history (weekday cached by loop's 1s RTC read)
+    userData.stepHistory[currentWeekday] = userData.steps;
 }
 
 // 
@@ -6780,13 +8334,11 @@ void handleBootButton() {
     
         // Short press - navigate categories
         if (pressDuration < 1000) {
+            // Runs in loop() - hand the LVGL work to ui_task
             if (!screenOn) {
-                screenOnFunc();
-            } else if (canNavigate()) {
-                int newCategory = (currentCategory + 1) % NUM_CATEGORIES;
-                currentCategory = newCategory;
-                currentSubCard = 0;
-                navigateTo(currentCategory, currentSubCard);
+                ui_post_event(UI_EVENT_SCREEN_ON);
+            } else {
+                ui_post_event(UI_EVENT_NEXT_CATEGORY);
                 lastActivityMs = now;
             }
         }
@@ -7460,115 +9012,6 @@ void createCurrencyConverterCard() {
 
 //  PREMIUM WIDGET API FUNCTIONS
 
-void fetchSunriseSunsetData() {
-    if (!wifiConnected) {
-        return;
-    }
-
-    // Use Perth, Australia coordinates (from weatherCity)
-    float lat = -31.9505;
-    float lng = 115.8605;
-
-    HTTPClient http;
-    char url[200];
-    snprintf(url, sizeof(url), 
-             "https://api.sunrise-sunset.org/json?lat=%.4f&lng=%.4f&formatted=0",
-             lat, lng);
-
-    http.begin(url);
-    int httpCode = http.GET();
-
-    if (httpCode == 200) {
-        String payload = http.getString();
-    
-        DynamicJsonDocument doc(2048);
-        DeserializationError error = deserializeJson(doc, payload);
-    
-        if (!error) {
-            const char* sunrise = doc["results"]["sunrise"];
-            const char* sunset = doc["results"]["sunset"];
-        
-            if (sunrise && sunset) {
-                // Parse ISO 8601 time: "2025-01-27T21:39:15+00:00"
-                // Extract HH:MM from position 11-15
-                strncpy(sunData.sunriseTime, sunrise + 11, 5);
-                sunData.sunriseTime[5] = '\0';
-                strncpy(sunData.sunsetTime, sunset + 11, 5);
-                sunData.sunsetTime[5] = '\0';
-            
-                // Convert to local time (add GMT offset)
-                int sunriseHour = atoi(sunData.sunriseTime);
-                int sunsetHour = atoi(sunData.sunsetTime);
-                sunriseHour = (sunriseHour + (gmtOffsetSec / 3600)) % 24;
-                sunsetHour = (sunsetHour + (gmtOffsetSec / 3600)) % 24;
-            
-                snprintf(sunData.sunriseTime, 6, "%02d:%s", sunriseHour, sunData.sunriseTime + 3);
-                snprintf(sunData.sunsetTime, 6, "%02d:%s", sunsetHour, sunData.sunsetTime + 3);
-            
-                // Calculate approximate azimuth angles
-                // Sunrise is roughly east (90), sunset is roughly west (270)
-                // For Perth in summer, sunrise ~60-120, sunset ~240-300
-                sunData.sunriseAzimuth = 90.0;  // Simplified - east
-                sunData.sunsetAzimuth = 270.0;  // Simplified - west
-            
-                sunData.valid = true;
-                sunData.lastFetch = millis();
-            
-                USBSerial.printf("[SUNRISE] Sunrise: %s, Sunset: %s\n", 
-                               sunData.sunriseTime, sunData.sunsetTime);
-            }
-        } else {
-        }
-    } else {
-    }
-
-    http.end();
-}
-
-void fetchCurrencyRates() {
-    if (!wifiConnected) {
-        return;
-    }
-
-    // Check if update needed (10 minutes)
-    if (currencyData.valid && 
-        (millis() - currencyData.lastUpdate < CURRENCY_UPDATE_INTERVAL)) {
-        return;  // Still fresh
-    }
-
-    HTTPClient http;
-    char url[300];
-    snprintf(url, sizeof(url),
-             "https://api.currencyapi.com/v3/latest?apikey=%s&base_currency=%s&currencies=USD,AUD",
-             CURRENCY_API_KEY, currencyData.sourceCurrency);
-
-    http.begin(url);
-    int httpCode = http.GET();
-
-    if (httpCode == 200) {
-        String payload = http.getString();
-    
-        DynamicJsonDocument doc(2048);
-        DeserializationError error = deserializeJson(doc, payload);
-    
-        if (!error) {
-            currencyData.usdRate = doc["data"]["USD"]["value"];
-            currencyData.audRate = doc["data"]["AUD"]["value"];
-            currencyData.valid = true;
-            currencyData.lastUpdate = millis();
-        
-            USBSerial.printf("[CURRENCY] %s -> USD: %.4f, AUD: %.4f\n",
-                           currencyData.sourceCurrency,
-                           currencyData.usdRate,
-                           currencyData.audRate);
-        } else {
-        }
-    } else {
-    }
-
-    http.end();
-}
-
 void calibrateCompassNorth() {
     // Set current heading as "north"
     compassNorthOffset = -compassHeadingSmooth;
@@ -8164,80 +9607,894 @@ void listSDDirectory(const char* dirname, uint8_t levels) {
     root.close();
 }
 
-void scanSDFaces() {
-    if (!hasSD || !sdCardInitialized) {
-        return;
-    }
+// 
+//  WATCH FACE ENGINE
+//  face.json is compiled once, at install, into face.wfc next to it:
+//    FaceBinHeader | FaceBinElement[elementCount] | string pool | assets
+//  Assets are raw lv_color_t (RGB565) pixels copied from the face folder,
+//  so drawing an image is a pointer into the blob. Every compiled face gets
+//  a fixed-size record in FACE_INDEX_PATH; boot reads that one file instead
+//  of parsing each face.json, and only rebuilds it when it is missing or
+//  on WIDGET_RESCAN_FACES (faces copied to or deleted from the card directly).
+//  The active face is read whole into PSRAM and rendered as CAT_CLOCK card
+//  0. Each refresh only touches elements whose tick class (second, minute,
+//  day, sensor data) has changed since the last one.
+//
+//  face.json:
+//    {"name":"Neon","author":"me","version":"1.0","supports":["2.06"],
+//     "background":"#000000",
+//     "elements":[
+//       {"type":"image","src":"logo.565","w":64,"h":64,"align":"top","y":40},
+//       {"type":"time","font":48,"color":"#FFFFFF","format":"12h"},
+//       {"type":"hand_minute","length":150,"width":6,"color":"#FF9F0A"}]}
+//  Element types are listed in faceTypeNames[]. x/y offset from "align"
+//  (default centre); hands pivot on the screen centre plus x/y.
+// 
+#define FACE_BLOB_MAGIC      0x31434657   // "WFC1"
+#define FACE_BLOB_VERSION    2
+#define FACE_INDEX_MAGIC     0x31584946   // "FIX1"
+#define FACE_INDEX_VERSION   2            // Bumped with FACE_BLOB_VERSION to force a rescan
+#define FACE_MAX_ELEMENTS    64
+#define FACE_MAX_STRINGS     2048         // String pool bytes per face
+#define FACE_MAX_JSON_SIZE   16384
+#define FACE_JSON_DOC_SIZE   24576
+#define FACE_MAX_BLOB_SIZE   (1024 * 1024)
+#define FACE_INDEX_MAX       1024
+#define FACE_IMPORTED_PREFIX "imported/"  // Key prefix for faces in SD_FACES_IMPORTED_PATH
+
+enum FaceElementType {
+    FACE_EL_RECT, FACE_EL_IMAGE, FACE_EL_TEXT,
+    FACE_EL_TIME, FACE_EL_SECONDS, FACE_EL_DATE, FACE_EL_WEEKDAY,
+    FACE_EL_BATTERY, FACE_EL_STEPS, FACE_EL_WEATHER,
+    FACE_EL_HAND_HOUR, FACE_EL_HAND_MINUTE, FACE_EL_HAND_SECOND,
+    FACE_EL_COUNT
+};
 
-    numSDFaces = 0;
+// What makes an element's content change; 0 = drawn once
+#define FACE_TICK_SECOND  0x01
+#define FACE_TICK_MINUTE  0x02
+#define FACE_TICK_DAY     0x04
+#define FACE_TICK_DATA    0x08      // Battery, steps, weather
+
+#define FACE_FLAG_12H     0x01      // FACE_EL_TIME: 12-hour clock
+
+static const char *faceTypeNames[FACE_EL_COUNT] = {
+    "rect", "image", "text",
+    "time", "seconds", "date", "weekday",
+    "battery", "steps", "weather",
+    "hand_hour", "hand_minute", "hand_second"
+};
+
+static const uint8_t faceTypeTicks[FACE_EL_COUNT] = {
+    0, 0, 0,
+    FACE_TICK_MINUTE, FACE_TICK_SECOND, FACE_TICK_DAY, FACE_TICK_DAY,
+    FACE_TICK_DATA, FACE_TICK_DATA, FACE_TICK_DATA,
+    FACE_TICK_MINUTE, FACE_TICK_MINUTE, FACE_TICK_SECOND
+};
+
+// Element "font" sizes resolve to the nearest built-in Montserrat
+static const lv_font_t *faceFonts[] = {
+    &lv_font_montserrat_10, &lv_font_montserrat_12, &lv_font_montserrat_14,
+    &lv_font_montserrat_16, &lv_font_montserrat_18, &lv_font_montserrat_20,
+    &lv_font_montserrat_24, &lv_font_montserrat_28, &lv_font_montserrat_32,
+    &lv_font_montserrat_36, &lv_font_montserrat_48
+};
+static const uint8_t faceFontSizes[] = {10, 12, 14, 16, 18, 20, 24, 28, 32, 36, 48};
+#define FACE_NUM_FONTS (sizeof(faceFontSizes) / sizeof(faceFontSizes[0]))
+
+static const struct { const char *name; lv_align_t align; } faceAligns[] = {
+    {"center", LV_ALIGN_CENTER},
+    {"top_left", LV_ALIGN_TOP_LEFT}, {"top", LV_ALIGN_TOP_MID}, {"top_right", LV_ALIGN_TOP_RIGHT},
+    {"left", LV_ALIGN_LEFT_MID}, {"right", LV_ALIGN_RIGHT_MID},
+    {"bottom_left", LV_ALIGN_BOTTOM_LEFT}, {"bottom", LV_ALIGN_BOTTOM_MID}, {"bottom_right", LV_ALIGN_BOTTOM_RIGHT}
+};
+
+struct FaceBinHeader {
+    uint32_t magic;              // FACE_BLOB_MAGIC
+    uint16_t version;            // FACE_BLOB_VERSION
+    uint16_t elementCount;
+    uint32_t background;         // 0xRRGGBB
+    uint32_t srcSize;            // face.json size this was compiled from
+    uint32_t srcCrc;             // CRC-32 of that face.json
+    uint32_t assetSig;           // faceSourceSignature() of the folder's other files
+    uint8_t supportsCurrentScreen;
+    uint8_t tickMask;            // FACE_TICK_* used by any element
+    uint16_t reserved;
+    uint32_t stringsOffset, stringsSize;
+    uint32_t assetsOffset, assetsSize;
+    uint32_t crc;                // CRC-32 of everything after the header
+    char name[32];
+    char author[32];
+    char versionStr[16];
+};
+static_assert(sizeof(FaceBinHeader) == 128, "face.wfc header layout");
+
+struct FaceBinElement {
+    uint8_t type;                // FaceElementType
+    uint8_t align;               // lv_align_t
+    uint8_t font;                // Index into faceFonts[]
+    uint8_t flags;               // FACE_FLAG_*
+    int16_t x, y;
+    uint16_t w, h;
+    uint32_t color;              // 0xRRGGBB
+    uint32_t ref;                // TEXT: string pool offset, IMAGE: asset offset
+    uint16_t param;              // RECT: radius, hands: length
+    uint16_t param2;             // Hands: width
+};
+static_assert(sizeof(FaceBinElement) == 24, "face.wfc element layout");
+
+struct FaceIndexHeader {
+    uint32_t magic;              // FACE_INDEX_MAGIC
+    uint16_t version;
+    uint16_t recordSize;         // sizeof(SDFace)
+    uint32_t count;
+    uint32_t crc;                // CRC-32 of the records
+};
+
+// A compiled face loaded for display (ui_task owns the active one)
+struct FaceBlob {
+    uint8_t *data;               // Whole face.wfc, PSRAM
+    uint32_t size;
+    const FaceBinHeader *hdr;
+    const FaceBinElement *els;
+    const char *strings;
+    const uint8_t *assets;
+    lv_obj_t **objs;             // Live widgets, valid while the card is shown
+    lv_img_dsc_t *imgs;
+    lv_point_t (*hands)[2];
+    char id[48];                 // Selection key (faceIndexFindKey())
+    int lastSec, lastMin, lastDay;
+};
 
-    // Scan custom faces
-    scanFacesInDirectory(SD_FACES_CUSTOM_PATH);
+struct FaceStats {
+    uint32_t indexLoadUs;        // Boot index read
+    uint32_t indexRebuilds;
+    uint32_t compiled;
+    uint32_t compileErrors;
+    uint32_t lastCompileMs;
+    uint32_t loadUs;             // Last face.wfc read + verify
+    uint32_t buildUs;            // Last full card build
+    uint32_t ticks;              // In-place refreshes
+    uint32_t lastTickUs, maxTickUs;
+    uint16_t lastTickElements;   // Elements touched by the last refresh
+    uint16_t activeElements;
+    char activeId[48];           // Key, "" = built-in clock
+};
+
+// Scratch for compileFace(), allocated on first install and kept
+struct FaceCompileScratch {
+    FaceBinElement els[FACE_MAX_ELEMENTS];
+    const char *assetNames[FACE_MAX_ELEMENTS];   // Into the parsed face.json
+    char pool[FACE_MAX_STRINGS];
+};
 
-    // Scan imported faces
-    scanFacesInDirectory(SD_FACES_IMPORTED_PATH);
+static String faceDirPath(const SDFace &rec);
+static bool faceIndexUpsert(const SDFace &rec);
+static bool compileFace(const char *dirPath, SDFace &rec);
+static bool faceRecordFromBlob(const char *dirPath, SDFace &rec);
+static bool faceAssetNameOk(const char *name);
+static void faceRecordFromHeader(const FaceBinHeader &hdr, SDFace &rec);
+static FaceBlob *loadFaceBlob(const SDFace &rec);
+static void freeFaceBlob(FaceBlob *f);
+static void faceAimHand(FaceBlob *f, int i, int deg);
+static void faceCreateElement(FaceBlob *f, lv_obj_t *root, int i);
+static void faceUpdateElement(FaceBlob *f, int i, RTC_DateTime &dt);
+
+static FaceCompileScratch *faceScratch = NULL;
+static FaceBlob *activeFace = NULL;                       // ui_task only
+static std::atomic<FaceBlob *> facePending(NULL);         // Loaded by selectFace(), taken by ui_task
+static std::atomic<bool> faceSwapPending(false);
+std::atomic<bool> faceTicksSeconds(false);                // Active face needs 1 Hz refreshes
+FaceStats faceStats = {};
+
+static String faceDirPath(const SDFace &rec) {
+    return String(rec.imported ? SD_FACES_IMPORTED_PATH : SD_FACES_CUSTOM_PATH) + "/" + rec.id;
+}
+
+// Custom and imported faces live in separate folders and may share a name
+static int faceIndexFind(const char *id, bool imported) {
+    for (int i = 0; i < numSDFaces; i++) {
+        if (sdFaces[i].imported == imported && strcmp(sdFaces[i].id, id) == 0) return i;
+    }
+    return -1;
+}
+
+// Faces are selected by key: the id for a custom face, FACE_IMPORTED_PREFIX + id
+// for an imported one
+static int faceIndexFindKey(const char *key) {
+    size_t prefixLen = strlen(FACE_IMPORTED_PREFIX);
+    if (strncmp(key, FACE_IMPORTED_PREFIX, prefixLen) == 0) return faceIndexFind(key + prefixLen, true);
+    return faceIndexFind(key, false);
+}
+
+static bool faceIndexReserve(int count) {
+    if (count <= sdFacesCapacity) return true;
+    if (count > FACE_INDEX_MAX) return false;
+    int cap = max(count, max(16, sdFacesCapacity * 2));
+    SDFace *grown = (SDFace *)heap_caps_realloc(sdFaces, cap * sizeof(SDFace), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (grown == NULL) return false;
+    sdFaces = grown;
+    sdFacesCapacity = cap;
+    return true;
+}
 
-    logToBootLog("Scanned SD card for custom faces");
+static bool faceIndexUpsert(const SDFace &rec) {
+    int idx = faceIndexFind(rec.id, rec.imported);
+    if (idx < 0) {
+        if (!faceIndexReserve(numSDFaces + 1)) return false;
+        idx = numSDFaces++;
+    }
+    sdFaces[idx] = rec;
+    return true;
 }
 
-void scanFacesInDirectory(const char* dirPath) {
-    if (!SD_MMC.exists(dirPath)) return;
+static bool writeFaceIndex() {
+    FaceIndexHeader hdr = {FACE_INDEX_MAGIC, FACE_INDEX_VERSION, sizeof(SDFace), (uint32_t)numSDFaces, 0};
+    size_t bytes = numSDFaces * sizeof(SDFace);
+    if (bytes) hdr.crc = esp_rom_crc32_le(0, (const uint8_t *)sdFaces, bytes);
+
+    String tmpPath = String(FACE_INDEX_PATH) + ".tmp";
+    File f = SD_MMC.open(tmpPath.c_str(), FILE_WRITE);
+    if (!f) return false;
+    bool ok = f.write((const uint8_t *)&hdr, sizeof(hdr)) == sizeof(hdr) &&
+              (bytes == 0 || f.write((const uint8_t *)sdFaces, bytes) == bytes);
+    f.close();
+    if (!ok) {
+        sdHealth.writeErrors++;
+        SD_MMC.remove(tmpPath.c_str());
+        return false;
+    }
+    SD_MMC.remove(FACE_INDEX_PATH);
+    return SD_MMC.rename(tmpPath.c_str(), FACE_INDEX_PATH);
+}
 
+static void faceIndexScanDir(const char *dirPath, bool imported) {
     File dir = SD_MMC.open(dirPath);
     if (!dir || !dir.isDirectory()) return;
 
-    File faceDir = dir.openNextFile();
-    while (faceDir && numSDFaces < MAX_SD_FACES) {
-        if (faceDir.isDirectory()) {
-            // Check for face.json
-            String facePath = String(faceDir.path()) + "/face.json";
-            if (SD_MMC.exists(facePath.c_str())) {
-                // Load face info
-                File faceJson = SD_MMC.open(facePath.c_str(), FILE_READ);
-                if (faceJson) {
-                    StaticJsonDocument<512> doc;
-                    DeserializationError error = deserializeJson(doc, faceJson);
-                    faceJson.close();
-                
-                    if (!error) {
-                        strncpy(sdFaces[numSDFaces].folderPath, faceDir.path(), sizeof(sdFaces[numSDFaces].folderPath) - 1);
-                    
-                        if (doc.containsKey("name")) {
-                            strncpy(sdFaces[numSDFaces].name, doc["name"].as<const char*>(), sizeof(sdFaces[numSDFaces].name) - 1);
-                        } else {
-                            strncpy(sdFaces[numSDFaces].name, faceDir.name(), sizeof(sdFaces[numSDFaces].name) - 1);
-                        }
-                    
-                        if (doc.containsKey("author")) {
-                            strncpy(sdFaces[numSDFaces].author, doc["author"].as<const char*>(), sizeof(sdFaces[numSDFaces].author) - 1);
-                        }
-                    
-                        if (doc.containsKey("version")) {
-                            strncpy(sdFaces[numSDFaces].version, doc["version"].as<const char*>(), sizeof(sdFaces[numSDFaces].version) - 1);
-                        }
-                    
-                        // Check screen support
-                        sdFaces[numSDFaces].supportsCurrentScreen = true;
-                        if (doc.containsKey("supports")) {
-                            JsonArray supports = doc["supports"].as<JsonArray>();
-                            sdFaces[numSDFaces].supportsCurrentScreen = false;
-                            for (JsonVariant v : supports) {
-                                if (String(v.as<const char*>()) == DEVICE_SCREEN) {
-                                    sdFaces[numSDFaces].supportsCurrentScreen = true;
-                                    break;
-                                }
-                            }
-                        }
-                    
-                        sdFaces[numSDFaces].valid = true;
-                        numSDFaces++;
-                    }
-                }
+    File entry = dir.openNextFile();
+    while (entry) {
+        if (entry.isDirectory() && strlen(entry.name()) < sizeof(SDFace::id)) {
+            String path = entry.path();
+            SDFace rec = {};
+            if (faceRecordFromBlob(path.c_str(), rec) || compileFace(path.c_str(), rec)) {
+                strncpy(rec.id, entry.name(), sizeof(rec.id) - 1);
+                rec.imported = imported;
+                if (!faceIndexUpsert(rec)) break;
             }
         }
-        faceDir = dir.openNextFile();
+        entry = dir.openNextFile();
+    }
+    dir.close();
+}
+
+// Full rescan: reuses each up-to-date face.wfc, compiles the rest
+void rebuildFaceIndex() {
+    if (!hasSD) return;
+    numSDFaces = 0;
+    faceIndexScanDir(SD_FACES_CUSTOM_PATH, false);
+    faceIndexScanDir(SD_FACES_IMPORTED_PATH, true);
+    writeFaceIndex();
+    faceStats.indexRebuilds++;
+    logToBootLog("Rebuilt watch face index");
+}
+
+// Boot: one read of the index, a rescan only if it is missing or damaged
+void loadFaceIndex() {
+    if (!hasSD) return;
+    uint32_t t0 = micros();
+    bool ok = false;
+
+    File f = SD_MMC.open(FACE_INDEX_PATH, FILE_READ);
+    if (f) {
+        FaceIndexHeader hdr;
+        if (f.read((uint8_t *)&hdr, sizeof(hdr)) == sizeof(hdr) &&
+            hdr.magic == FACE_INDEX_MAGIC && hdr.version == FACE_INDEX_VERSION &&
+            hdr.recordSize == sizeof(SDFace) && hdr.count <= FACE_INDEX_MAX &&
+            f.size() == sizeof(hdr) + hdr.count * sizeof(SDFace) &&
+            faceIndexReserve(hdr.count)) {
+            size_t bytes = hdr.count * sizeof(SDFace);
+            ok = (bytes == 0 || f.read((uint8_t *)sdFaces, bytes) == bytes) &&
+                 (bytes == 0 || esp_rom_crc32_le(0, (const uint8_t *)sdFaces, bytes) == hdr.crc);
+            numSDFaces = ok ? hdr.count : 0;
+        }
+        f.close();
+    }
+    faceStats.indexLoadUs = micros() - t0;
+
+    if (!ok) rebuildFaceIndex();
+    USBSerial.printf("[FACE] %d faces indexed (%lu us)\n", numSDFaces, (unsigned long)faceStats.indexLoadUs);
+}
+
+// A face id is one folder name under SD_FACES_CUSTOM_PATH, never a path
+bool faceIdValid(const char *faceId) {
+    return strlen(faceId) < sizeof(SDFace::id) && faceAssetNameOk(faceId);
+}
+
+// Compile (or recompile) one custom face and update its index record.
+// Called after each file of a face that has a face.json, so a new face's
+// assets are sent before its face.json; later files recompile it.
+bool installFace(const char *faceId) {
+    if (!hasSD || !faceIdValid(faceId)) return false;
+    String dirPath = String(SD_FACES_CUSTOM_PATH) + "/" + faceId;
+    SDFace rec = {};
+    if (!compileFace(dirPath.c_str(), rec)) return false;
+    strncpy(rec.id, faceId, sizeof(rec.id) - 1);
+    return faceIndexUpsert(rec) && writeFaceIndex();
+}
+
+static void faceRecordFromHeader(const FaceBinHeader &hdr, SDFace &rec) {
+    memcpy(rec.name, hdr.name, sizeof(rec.name));
+    memcpy(rec.author, hdr.author, sizeof(rec.author));
+    memcpy(rec.version, hdr.versionStr, sizeof(rec.version));
+    rec.name[sizeof(rec.name) - 1] = '\0';
+    rec.author[sizeof(rec.author) - 1] = '\0';
+    rec.version[sizeof(rec.version) - 1] = '\0';
+    rec.srcSize = hdr.srcSize;
+    rec.blobSize = hdr.assetsOffset + hdr.assetsSize;
+    rec.elementCount = hdr.elementCount;
+    rec.supportsCurrentScreen = hdr.supportsCurrentScreen;
+}
+
+// CRC-32 of face.json, plus an order-independent sum over the name and size
+// of every other file in the folder (the assets), so an edit that keeps
+// face.json's size or a replaced asset is noticed without parsing anything
+static bool faceSourceSignature(const char *dirPath, uint32_t &srcCrc, uint32_t &assetSig) {
+    String base = dirPath;
+    File src = SD_MMC.open((base + "/face.json").c_str(), FILE_READ);
+    if (!src) return false;
+    uint8_t buf[512];
+    srcCrc = 0;
+    while (src.available()) {
+        size_t n = src.read(buf, sizeof(buf));
+        if (n == 0) break;
+        srcCrc = esp_rom_crc32_le(srcCrc, buf, n);
+    }
+    src.close();
+
+    assetSig = 0;
+    File dir = SD_MMC.open(dirPath);
+    if (!dir || !dir.isDirectory()) return false;
+    File entry = dir.openNextFile();
+    while (entry) {
+        String fname = entry.name();
+        if (!entry.isDirectory() && fname != "face.json" && fname != FACE_BLOB_NAME &&
+            !fname.endsWith(".tmp") && !fname.endsWith(".part")) {
+            uint32_t size = entry.size();
+            uint32_t crc = esp_rom_crc32_le(0, (const uint8_t *)fname.c_str(), fname.length());
+            assetSig += esp_rom_crc32_le(crc, (const uint8_t *)&size, sizeof(size));
+        }
+        entry.close();
+        entry = dir.openNextFile();
     }
     dir.close();
+    return true;
+}
+
+// An existing face.wfc counts if it was compiled from the current face.json
+// and assets
+static bool faceRecordFromBlob(const char *dirPath, SDFace &rec) {
+    String base = dirPath;
+    File blob = SD_MMC.open((base + "/" FACE_BLOB_NAME).c_str(), FILE_READ);
+    if (!blob) return false;
+    FaceBinHeader hdr;
+    bool ok = blob.read((uint8_t *)&hdr, sizeof(hdr)) == sizeof(hdr) &&
+              hdr.magic == FACE_BLOB_MAGIC && hdr.version == FACE_BLOB_VERSION &&
+              blob.size() == hdr.assetsOffset + hdr.assetsSize;
+    blob.close();
+
+    uint32_t srcCrc, assetSig;
+    ok = ok && faceSourceSignature(dirPath, srcCrc, assetSig) &&
+         hdr.srcCrc == srcCrc && hdr.assetSig == assetSig;
+    if (ok) faceRecordFromHeader(hdr, rec);
+    return ok;
+}
+
+static uint32_t faceParseColor(JsonVariantConst v, uint32_t fallback) {
+    if (v.is<uint32_t>()) return v.as<uint32_t>() & 0xFFFFFF;
+    const char *s = v.as<const char *>();
+    if (s == NULL) return fallback;
+    if (*s == '#') s++;
+    return strtoul(s, NULL, 16) & 0xFFFFFF;
+}
+
+static uint8_t faceParseAlign(const char *name) {
+    for (size_t i = 0; i < sizeof(faceAligns) / sizeof(faceAligns[0]); i++) {
+        if (strcmp(faceAligns[i].name, name) == 0) return faceAligns[i].align;
+    }
+    return LV_ALIGN_CENTER;
+}
+
+static uint8_t faceFontIndex(int size) {
+    uint8_t best = 0;
+    for (uint8_t i = 1; i < FACE_NUM_FONTS; i++) {
+        if (abs(faceFontSizes[i] - size) < abs(faceFontSizes[best] - size)) best = i;
+    }
+    return best;
+}
+
+// Returns the string's pool offset, or -1 when the pool is full
+static int32_t facePoolAdd(uint32_t &poolSize, const char *s) {
+    size_t len = strlen(s) + 1;
+    if (poolSize + len > FACE_MAX_STRINGS) return -1;
+    memcpy(faceScratch->pool + poolSize, s, len);
+    poolSize += len;
+    return poolSize - len;
+}
+
+// Asset names and face ids are a single path segment: no "/", no leading "."
+static bool faceAssetNameOk(const char *name) {
+    if (name == NULL || *name == '\0' || *name == '.') return false;
+    for (const char *p = name; *p; p++) {
+        if (!isalnum((unsigned char)*p) && strchr("_-.", *p) == NULL) return false;
+    }
+    return true;
+}
+
+static bool faceWriteChecked(File &f, const void *data, size_t len, uint32_t &crc) {
+    crc = esp_rom_crc32_le(crc, (const uint8_t *)data, len);
+    return f.write((const uint8_t *)data, len) == len;
+}
+
+static bool compileFace(const char *dirPath, SDFace &rec) {
+    uint32_t t0 = millis();
+    String base = dirPath;
+    File src = SD_MMC.open((base + "/face.json").c_str(), FILE_READ);
+    if (!src) return false;
+    uint32_t srcSize = src.size();
+    if (srcSize > FACE_MAX_JSON_SIZE) {
+        src.close();
+        faceStats.compileErrors++;
+        return false;
+    }
+    DynamicJsonDocument doc(FACE_JSON_DOC_SIZE);
+    DeserializationError err = deserializeJson(doc, src);
+    src.close();
+    if (err) {
+        USBSerial.printf("[FACE] %s: %s\n", dirPath, err.c_str());
+        faceStats.compileErrors++;
+        return false;
+    }
+
+    if (faceScratch == NULL) {
+        faceScratch = (FaceCompileScratch *)heap_caps_malloc(sizeof(FaceCompileScratch), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        if (faceScratch == NULL) return false;
+    }
+
+    FaceBinHeader hdr = {};
+    hdr.magic = FACE_BLOB_MAGIC;
+    hdr.version = FACE_BLOB_VERSION;
+    hdr.srcSize = srcSize;
+    if (!faceSourceSignature(dirPath, hdr.srcCrc, hdr.assetSig)) return false;
+    hdr.background = faceParseColor(doc["background"], 0x000000);
+    const char *faceId = strrchr(dirPath, '/');
+    strncpy(hdr.name, doc["name"] | (faceId ? faceId + 1 : dirPath), sizeof(hdr.name) - 1);
+    strncpy(hdr.author, doc["author"] | "", sizeof(hdr.author) - 1);
+    strncpy(hdr.versionStr, doc["version"] | "", sizeof(hdr.versionStr) - 1);
+
+    hdr.supportsCurrentScreen = true;
+    if (doc.containsKey("supports")) {
+        hdr.supportsCurrentScreen = false;
+        for (JsonVariantConst v : doc["supports"].as<JsonArrayConst>()) {
+            if (v == DEVICE_SCREEN) {
+                hdr.supportsCurrentScreen = true;
+                break;
+            }
+        }
+    }
+
+    uint32_t poolSize = 0;
+    uint16_t count = 0;
+    bool ok = true;
+    for (JsonObjectConst e : doc["elements"].as<JsonArrayConst>()) {
+        if (count == FACE_MAX_ELEMENTS) {
+            ok = false;
+            break;
+        }
+        const char *typeName = e["type"] | "";
+        int type = 0;
+        while (type < FACE_EL_COUNT && strcmp(faceTypeNames[type], typeName) != 0) type++;
+        if (type == FACE_EL_COUNT) continue;   // Newer element kinds are skipped, not fatal
+
+        FaceBinElement &el = faceScratch->els[count];
+        memset(&el, 0, sizeof(el));
+        el.type = type;
+        el.align = faceParseAlign(e["align"] | "center");
+        el.font = faceFontIndex(e["font"] | 24);
+        el.flags = strcmp(e["format"] | "24h", "12h") == 0 ? FACE_FLAG_12H : 0;
+        el.x = e["x"] | 0;
+        el.y = e["y"] | 0;
+        el.w = e["w"] | 0;
+        el.h = e["h"] | 0;
+        el.color = faceParseColor(e["color"], 0xFFFFFF);
+
+        if (type == FACE_EL_RECT) {
+            el.param = e["radius"] | 0;
+        } else if (type == FACE_EL_TEXT) {
+            int32_t ref = facePoolAdd(poolSize, e["text"] | "");
+            if (ref < 0) ok = false;
+            el.ref = ref;
+        } else if (type == FACE_EL_IMAGE) {
+            // Raw pixels, w * h * sizeof(lv_color_t), converted by the host
+            const char *assetName = e["src"];
+            uint32_t bytes = (uint32_t)el.w * el.h * sizeof(lv_color_t);
+            File asset;
+            if (faceAssetNameOk(assetName)) asset = SD_MMC.open((base + "/" + assetName).c_str(), FILE_READ);
+            if (!asset || bytes == 0 || asset.size() != bytes) ok = false;
+            if (asset) asset.close();
+            el.ref = hdr.assetsSize;
+            hdr.assetsSize += (bytes + 3) & ~3;
+            faceScratch->assetNames[count] = assetName;
+        } else if (type >= FACE_EL_HAND_HOUR) {
+            el.param = e["length"] | 100;
+            el.param2 = e["width"] | 4;
+        }
+        if (!ok) break;
+        hdr.tickMask |= faceTypeTicks[type];
+        count++;
+    }
+
+    hdr.elementCount = count;
+    hdr.stringsOffset = sizeof(FaceBinHeader) + count * sizeof(FaceBinElement);
+    hdr.stringsSize = (poolSize + 3) & ~3;
+    hdr.assetsOffset = hdr.stringsOffset + hdr.stringsSize;
+    if (!ok || hdr.assetsOffset + hdr.assetsSize > FACE_MAX_BLOB_SIZE) {
+        USBSerial.printf("[FACE] %s: invalid element or missing asset\n", dirPath);
+        faceStats.compileErrors++;
+        return false;
+    }
+    memset(faceScratch->pool + poolSize, 0, hdr.stringsSize - poolSize);
+
+    // Header goes last, once the CRC is known
+    String blobPath = base + "/" FACE_BLOB_NAME;
+    String tmpPath = blobPath + ".tmp";
+    File out = SD_MMC.open(tmpPath.c_str(), FILE_WRITE);
+    if (!out) {
+        sdHealth.writeErrors++;
+        return false;
+    }
+    uint32_t crc = 0;
+    uint8_t buf[512];
+    ok = out.write((const uint8_t *)&hdr, sizeof(hdr)) == sizeof(hdr) &&
+         faceWriteChecked(out, faceScratch->els, count * sizeof(FaceBinElement), crc) &&
+         faceWriteChecked(out, faceScratch->pool, hdr.stringsSize, crc);
+    for (uint16_t i = 0; ok && i < count; i++) {
+        if (faceScratch->els[i].type != FACE_EL_IMAGE) continue;
+        File asset = SD_MMC.open((base + "/" + faceScratch->assetNames[i]).c_str(), FILE_READ);
+        if (!asset) {
+            ok = false;
+            break;
+        }
+        uint32_t bytes = asset.size();
+        while (ok && asset.available()) {
+            size_t n = asset.read(buf, sizeof(buf));
+            ok = n > 0 && faceWriteChecked(out, buf, n, crc);
+        }
+        asset.close();
+        memset(buf, 0, 4);
+        if (ok && (bytes & 3)) ok = faceWriteChecked(out, buf, 4 - (bytes & 3), crc);
+    }
+    hdr.crc = crc;
+    ok = ok && out.seek(0) && out.write((const uint8_t *)&hdr, sizeof(hdr)) == sizeof(hdr);
+    out.close();
+    if (!ok) {
+        sdHealth.writeErrors++;
+        SD_MMC.remove(tmpPath.c_str());
+        faceStats.compileErrors++;
+        return false;
+    }
+    SD_MMC.remove(blobPath.c_str());
+    if (!SD_MMC.rename(tmpPath.c_str(), blobPath.c_str())) return false;
+
+    faceRecordFromHeader(hdr, rec);
+    faceStats.compiled++;
+    faceStats.lastCompileMs = millis() - t0;
+    USBSerial.printf("[FACE] Compiled %s: %u elements, %lu bytes in %lu ms\n", hdr.name, count,
+                     (unsigned long)rec.blobSize, (unsigned long)faceStats.lastCompileMs);
+    return true;
+}
+
+// Read and verify face.wfc; the renderer trusts every offset after this
+static FaceBlob *loadFaceBlob(const SDFace &rec) {
+    uint32_t t0 = micros();
+    String blobPath = faceDirPath(rec) + "/" FACE_BLOB_NAME;
+    File file = SD_MMC.open(blobPath.c_str(), FILE_READ);
+    if (!file) return NULL;
+    uint32_t size = file.size();
+    uint8_t *data = NULL;
+    if (size >= sizeof(FaceBinHeader) && size <= FACE_MAX_BLOB_SIZE) {
+        data = (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    }
+    bool ok = data != NULL && file.read(data, size) == size;
+    file.close();
+
+    const FaceBinHeader *hdr = (const FaceBinHeader *)data;
+    ok = ok && hdr->magic == FACE_BLOB_MAGIC && hdr->version == FACE_BLOB_VERSION &&
+         hdr->elementCount <= FACE_MAX_ELEMENTS &&
+         hdr->stringsOffset == sizeof(FaceBinHeader) + hdr->elementCount * sizeof(FaceBinElement) &&
+         hdr->stringsSize <= FACE_MAX_STRINGS &&
+         hdr->assetsOffset == hdr->stringsOffset + hdr->stringsSize &&
+         hdr->assetsOffset + hdr->assetsSize == size &&
+         (hdr->stringsSize == 0 || data[hdr->assetsOffset - 1] == '\0') &&   // Empty without text elements
+         esp_rom_crc32_le(0, data + sizeof(FaceBinHeader), size - sizeof(FaceBinHeader)) == hdr->crc;
+
+    const FaceBinElement *els = (const FaceBinElement *)(data + sizeof(FaceBinHeader));
+    for (uint16_t i = 0; ok && i < hdr->elementCount; i++) {
+        const FaceBinElement &el = els[i];
+        ok = el.type < FACE_EL_COUNT && el.font < FACE_NUM_FONTS;
+        if (ok && el.type == FACE_EL_TEXT) ok = el.ref < hdr->stringsSize;
+        if (ok && el.type == FACE_EL_IMAGE) {
+            ok = el.ref + (uint32_t)el.w * el.h * sizeof(lv_color_t) <= hdr->assetsSize;
+        }
+    }
+    if (!ok) {
+        USBSerial.printf("[FACE] %s is damaged, reinstall it\n", rec.id);
+        heap_caps_free(data);
+        return NULL;
+    }
+
+    FaceBlob *blob = (FaceBlob *)heap_caps_calloc(1, sizeof(FaceBlob), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (blob == NULL) {
+        heap_caps_free(data);
+        return NULL;
+    }
+    blob->data = data;
+    uint16_t n = max((uint16_t)1, hdr->elementCount);
+    blob->objs = (lv_obj_t **)heap_caps_calloc(n, sizeof(lv_obj_t *), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    blob->imgs = (lv_img_dsc_t *)heap_caps_calloc(n, sizeof(lv_img_dsc_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    blob->hands = (lv_point_t (*)[2])heap_caps_calloc(n, sizeof(lv_point_t) * 2, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (blob->objs == NULL || blob->imgs == NULL || blob->hands == NULL) {
+        freeFaceBlob(blob);
+        return NULL;
+    }
+    blob->size = size;
+    blob->hdr = hdr;
+    blob->els = els;
+    blob->strings = (const char *)(data + hdr->stringsOffset);
+    blob->assets = data + hdr->assetsOffset;
+    snprintf(blob->id, sizeof(blob->id), "%s%s", rec.imported ? FACE_IMPORTED_PREFIX : "", rec.id);
+    faceStats.loadUs = micros() - t0;
+    return blob;
+}
+
+static void freeFaceBlob(FaceBlob *f) {
+    if (f == NULL) return;
+    heap_caps_free(f->objs);
+    heap_caps_free(f->imgs);
+    heap_caps_free(f->hands);
+    heap_caps_free(f->data);
+    heap_caps_free(f);
+}
+
+// Load a face (or the built-in clock for "" / "default") and hand it to
+// ui_task. Runs on the loop task; LVGL only sees it in applyPendingFace().
+bool selectFace(const char *id, bool persist) {
+    FaceBlob *blob = NULL;
+    if (id[0] != '\0' && strcmp(id, "default") != 0) {
+        int idx = faceIndexFindKey(id);
+        if (idx < 0 || !sdFaces[idx].supportsCurrentScreen) return false;
+        blob = loadFaceBlob(sdFaces[idx]);
+        if (blob == NULL) return false;
+    }
+
+    freeFaceBlob(facePending.exchange(blob));   // A swap ui_task hasn't taken yet
+    faceSwapPending = true;
+    ui_post_event(UI_EVENT_FACE_CHANGED);
+
+    if (persist) {
+        prefs.begin("minios", false);
+        prefs.putString("face", blob ? id : "");
+        prefs.end();
+    }
+    return true;
+}
+
+// Boot: the face chosen with WIDGET_SET_FACE last time
+void restoreSavedFace() {
+    prefs.begin("minios", true);
+    String id = prefs.getString("face", "");
+    prefs.end();
+    if (id.length() > 0 && !selectFace(id.c_str(), false)) {
+        USBSerial.printf("[FACE] Saved face %s unavailable, using built-in clock\n", id.c_str());
+    }
+}
+
+// ui_task: swap in the face selectFace() loaded, rebuilding the card only
+// if it is on screen. Elsewhere no widget points into the old blob.
+void applyPendingFace() {
+    if (!faceSwapPending.exchange(false)) return;
+    FaceBlob *old = activeFace;
+    activeFace = facePending.exchange(NULL);
+    faceTicksSeconds = activeFace != NULL && (activeFace->hdr->tickMask & FACE_TICK_SECOND);
+    strncpy(faceStats.activeId, activeFace ? activeFace->id : "", sizeof(faceStats.activeId) - 1);
+    faceStats.activeElements = activeFace ? activeFace->hdr->elementCount : 0;
+    if (currentCategory == CAT_CLOCK && currentSubCard == 0) {
+        navigateTo(CAT_CLOCK, 0);   // Old widgets are gone before their blob is
+    }
+    if (old != NULL) {
+        lv_img_cache_invalidate_src(NULL);
+        freeFaceBlob(old);
+    }
+}
+
+bool customFaceActive() {
+    return activeFace != NULL;
+}
+
+static void faceAimHand(FaceBlob *f, int i, int deg) {
+    const FaceBinElement &el = f->els[i];
+    lv_point_t *pts = f->hands[i];
+    pts[1].x = pts[0].x + dialDX(deg, el.param);
+    pts[1].y = pts[0].y + dialDY(deg, el.param);
+    lv_line_set_points(f->objs[i], pts, 2);
+}
+
+static void faceCreateElement(FaceBlob *f, lv_obj_t *root, int i) {
+    const FaceBinElement &el = f->els[i];
+    lv_color_t color = lv_color_hex(el.color);
+    lv_obj_t *obj;
+
+    if (el.type == FACE_EL_RECT) {
+        obj = lv_obj_create(root);
+        lv_obj_remove_style_all(obj);
+        lv_obj_set_size(obj, el.w, el.h);
+        lv_obj_set_style_bg_color(obj, color, 0);
+        lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+        lv_obj_set_style_radius(obj, el.param, 0);
+    } else if (el.type == FACE_EL_IMAGE) {
+        lv_img_dsc_t &img = f->imgs[i];
+        img.header.cf = LV_IMG_CF_TRUE_COLOR;
+        img.header.w = el.w;
+        img.header.h = el.h;
+        img.data_size = (uint32_t)el.w * el.h * sizeof(lv_color_t);
+        img.data = f->assets + el.ref;
+        obj = lv_img_create(root);
+        lv_img_set_src(obj, &img);
+    } else if (el.type >= FACE_EL_HAND_HOUR) {
+        f->hands[i][0].x = LCD_WIDTH / 2 + el.x;
+        f->hands[i][0].y = LCD_HEIGHT / 2 + el.y;
+        f->hands[i][1] = f->hands[i][0];
+        obj = lv_line_create(root);
+        lv_obj_set_style_line_width(obj, el.param2, 0);
+        lv_obj_set_style_line_color(obj, color, 0);
+        lv_obj_set_style_line_rounded(obj, true, 0);
+        lv_line_set_points(obj, f->hands[i], 2);
+        f->objs[i] = obj;
+        return;
+    } else {
+        obj = lv_label_create(root);
+        lv_obj_set_style_text_color(obj, color, 0);
+        lv_obj_set_style_text_font(obj, faceFonts[el.font], 0);
+        // Static text points into the blob, which outlives the card
+        lv_label_set_text_static(obj, el.type == FACE_EL_TEXT ? f->strings + el.ref : "");
+    }
+    lv_obj_align(obj, (lv_align_t)el.align, el.x, el.y);
+    f->objs[i] = obj;
+}
+
+static void faceUpdateElement(FaceBlob *f, int i, RTC_DateTime &dt) {
+    const FaceBinElement &el = f->els[i];
+    char buf[24];
+
+    switch (el.type) {
+        case FACE_EL_TIME:
+            if (el.flags & FACE_FLAG_12H) {
+                int h = dt.getHour() % 12;
+                snprintf(buf, sizeof(buf), "%d:%02d", h == 0 ? 12 : h, dt.getMinute());
+            } else {
+                snprintf(buf, sizeof(buf), "%02d:%02d", dt.getHour(), dt.getMinute());
+            }
+            break;
+        case FACE_EL_SECONDS:
+            snprintf(buf, sizeof(buf), "%02d", dt.getSecond());
+            break;
+        case FACE_EL_DATE:
+            snprintf(buf, sizeof(buf), "%s %d", clockMonthNames[dt.getMonth() - 1], dt.getDay());
+            break;
+        case FACE_EL_WEEKDAY:
+            snprintf(buf, sizeof(buf), "%s", clockDayNames[dt.getWeek()]);
+            break;
+        case FACE_EL_BATTERY:
+            snprintf(buf, sizeof(buf), "%d%%", batteryPercent);
+            break;
+        case FACE_EL_STEPS:
+            snprintf(buf, sizeof(buf), "%lu", (unsigned long)userData.steps);
+            break;
+        case FACE_EL_WEATHER:
+            snprintf(buf, sizeof(buf), "%.0fC", weatherTemp);
+            break;
+        case FACE_EL_HAND_HOUR:
+            faceAimHand(f, i, (dt.getHour() % 12) * 30 + dt.getMinute() / 2);
+            return;
+        case FACE_EL_HAND_MINUTE:
+            faceAimHand(f, i, dt.getMinute() * 6);
+            return;
+        case FACE_EL_HAND_SECOND:
+            faceAimHand(f, i, dt.getSecond() * 6);
+            return;
+        default:
+            return;
+    }
+    setLabelTextIfChanged(f->objs[i], buf);
+}
+
+bool updateCustomFaceCard() {
+    FaceBlob *f = activeFace;
+    if (f == NULL) return false;
+    uint32_t t0 = micros();
+
+    RTC_DateTime dt = rtc.getDateTime();
+    uint8_t due = FACE_TICK_DATA;
+    if (dt.getSecond() != f->lastSec) due |= FACE_TICK_SECOND;
+    if (dt.getMinute() != f->lastMin) due |= FACE_TICK_MINUTE;
+    if (dt.getDay() != f->lastDay) due |= FACE_TICK_DAY;
+    f->lastSec = dt.getSecond();
+    f->lastMin = dt.getMinute();
+    f->lastDay = dt.getDay();
+
+    uint16_t touched = 0;
+    for (uint16_t i = 0; i < f->hdr->elementCount; i++) {
+        if (!(faceTypeTicks[f->els[i].type] & due)) continue;
+        faceUpdateElement(f, i, dt);
+        touched++;
+    }
+
+    faceStats.ticks++;
+    faceStats.lastTickElements = touched;
+    faceStats.lastTickUs = micros() - t0;
+    if (faceStats.lastTickUs > faceStats.maxTickUs) faceStats.maxTickUs = faceStats.lastTickUs;
+    return true;
+}
+
+void createCustomFaceCard() {
+    FaceBlob *f = activeFace;
+    uint32_t t0 = micros();
+
+    lv_obj_t *root = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(root);
+    lv_obj_set_size(root, LCD_WIDTH, LCD_HEIGHT);
+    lv_obj_set_style_bg_color(root, lv_color_hex(f->hdr->background), 0);
+    lv_obj_set_style_bg_opa(root, LV_OPA_COVER, 0);
+    lv_obj_clear_flag(root, LV_OBJ_FLAG_SCROLLABLE);
+
+    RTC_DateTime dt = rtc.getDateTime();
+    for (uint16_t i = 0; i < f->hdr->elementCount; i++) {
+        faceCreateElement(f, root, i);
+        faceUpdateElement(f, i, dt);
+    }
+    f->lastSec = dt.getSecond();
+    f->lastMin = dt.getMinute();
+    f->lastDay = dt.getDay();
+
+    faceStats.buildUs = micros() - t0;
+    setCardUpdateHook(updateCustomFaceCard);
+}
+
+void printFaceList() {
+    USBSerial.printf("{\"type\":\"WIDGET_LIST_FACES_RESPONSE\",\"faces\":[");
+    for (int i = 0; i < numSDFaces; i++) {
+        const SDFace &rec = sdFaces[i];
+        USBSerial.printf("%s{\"id\":\"%s\",\"name\":\"%s\",\"author\":\"%s\",\"version\":\"%s\","
+                         "\"elements\":%u,\"bytes\":%lu,\"imported\":%s,\"supported\":%s}",
+                         i ? "," : "", rec.id, rec.name, rec.author, rec.version,
+                         rec.elementCount, (unsigned long)rec.blobSize,
+                         rec.imported ? "true" : "false", rec.supportsCurrentScreen ? "true" : "false");
+    }
+    USBSerial.println("]}");
+}
+
+void printFaceStats() {
+    USBSerial.printf("{\"type\":\"WIDGET_FACE_STATS_RESPONSE\",\"faces\":%d,\"index_load_us\":%lu,"
+                     "\"index_rebuilds\":%lu,\"compiled\":%lu,\"compile_errors\":%lu,\"last_compile_ms\":%lu,"
+                     "\"active\":\"%s\",\"elements\":%u,\"load_us\":%lu,\"build_us\":%lu,\"ticks\":%lu,"
+                     "\"last_tick_us\":%lu,\"max_tick_us\":%lu,\"last_tick_elements\":%u}\n",
+                     numSDFaces, (unsigned long)faceStats.indexLoadUs,
+                     (unsigned long)faceStats.indexRebuilds, (unsigned long)faceStats.compiled,
+                     (unsigned long)faceStats.compileErrors, (unsigned long)faceStats.lastCompileMs,
+                     faceStats.activeId, faceStats.activeElements,
+                     (unsigned long)faceStats.loadUs, (unsigned long)faceStats.buildUs,
+                     (unsigned long)faceStats.ticks, (unsigned long)faceStats.lastTickUs,
+                     (unsigned long)faceStats.maxTickUs, faceStats.lastTickElements);
 }
 
 //  SD CARD MANAGEMENT & BACKUP SYSTEM
@@ -8313,87 +10570,564 @@ void updateSDCardHealth() {
     }
 }
 
-bool createBackup(bool isAuto) {
-    if (!hasSD) {
-        return false;
-    }
+//  BACKUP ENGINE
+//  Snapshots are content-addressed. Every artifact (user data, compass
+//  calibration, config files, installed faces) is SHA-256 hashed and stored
+//  once as BACKUPS/blobs/<hash>.blob; a snapshot is just a small text
+//  manifest in BACKUPS/snapshots with one "+<hash> <size> <path>" line per
+//  artifact. Unchanged data costs one manifest line, so daily auto backups
+//  stay small. All SD work runs in backup_task at low priority;
+//  createBackup() only captures in-memory state and queues the job, whose
+//  outcome is reported in backupStats (WIDGET_BACKUP_STATS).
 
-    updateSDCardHealth();
-    if (!sdHealth.healthy) {
-        return false;
-    }
+struct BackupJob {
+    char name[40];
+    bool isAuto;
+    char *userJson;         // malloc'd by createBackup(), freed by backup_task
+    float compassOffset;
+};
 
-    // Get timestamp for backup folder
-    struct tm timeinfo;
-    char timestamp[32];
-    if (getLocalTime(&timeinfo)) {
-        strftime(timestamp, sizeof(timestamp), "%Y%m%d_%H%M%S", &timeinfo);
-    } else {
-        snprintf(timestamp, sizeof(timestamp), "backup_%lu", millis());
+static QueueHandle_t backupQueue = NULL;
+static SemaphoreHandle_t backupMutex = NULL;   // One snapshot, restore or listing at a time
+static uint8_t *backupChunk = NULL;            // DMA-capable, BACKUP_CHUNK_SIZE bytes
+static char backupSnapNames[BACKUP_MAX_SNAPSHOTS][40];
+BackupStats backupStats = {};
+
+static bool backupRunJob(BackupJob &job);
+static bool backupRestoreArtifact(const char *hash, uint32_t size, const char *path);
+
+// Truncated SHA-256 (128 bits) as 32 hex chars - ample for a few thousand blobs
+struct BackupHasher {
+    mbedtls_sha256_context ctx;
+
+    void begin() {
+        mbedtls_sha256_init(&ctx);
+#if MBEDTLS_VERSION_NUMBER >= 0x03000000
+        mbedtls_sha256_starts(&ctx, 0);
+#else
+        mbedtls_sha256_starts_ret(&ctx, 0);
+#endif
+    }
+    void update(const uint8_t *data, size_t len) {
+#if MBEDTLS_VERSION_NUMBER >= 0x03000000
+        mbedtls_sha256_update(&ctx, data, len);
+#else
+        mbedtls_sha256_update_ret(&ctx, data, len);
+#endif
+    }
+    void finish(char *hexOut) {
+        uint8_t digest[32];
+#if MBEDTLS_VERSION_NUMBER >= 0x03000000
+        mbedtls_sha256_finish(&ctx, digest);
+#else
+        mbedtls_sha256_finish_ret(&ctx, digest);
+#endif
+        mbedtls_sha256_free(&ctx);
+        for (int i = 0; i < 16; i++) snprintf(hexOut + i * 2, 3, "%02x", digest[i]);
     }
+};
 
-    String backupDir = String(SD_BACKUP_PATH) + "/" + timestamp;
-    if (isAuto) {
-        backupDir += "_auto";
+static String backupBlobPath(const char *hash) {
+    return String(SD_BACKUP_BLOBS_PATH) + "/" + hash + ".blob";
+}
+
+// Stream src to dst in whole chunks; returns bytes copied or -1 on a short write
+static int32_t backupCopyStream(File &src, File &dst) {
+    int32_t total = 0;
+    while (src.available()) {
+        size_t n = src.read(backupChunk, BACKUP_CHUNK_SIZE);
+        if (n == 0) break;
+        if (dst.write(backupChunk, n) != n) return -1;
+        total += n;
     }
+    return total;
+}
 
-    if (!SD_MMC.mkdir(backupDir.c_str())) {
+// Write a blob under a temp name and rename, so a pulled card never leaves a
+// truncated blob that later snapshots would trust
+static bool backupCommitBlob(const String &tmpPath, const char *hash) {
+    String blobPath = backupBlobPath(hash);
+    if (!SD_MMC.rename(tmpPath.c_str(), blobPath.c_str())) {
+        SD_MMC.remove(tmpPath.c_str());
+        sdHealth.writeErrors++;
         return false;
     }
+    return true;
+}
 
-    // Backup user data
-    File userFile = SD_MMC.open((backupDir + "/user_data.json").c_str(), FILE_WRITE);
-    if (userFile) {
-        DynamicJsonDocument doc(2048);
-        doc["brightness"] = userData.brightness;
-        doc["theme"] = userData.theme;
-        doc["vibration"] = userData.vibration;
-        doc["gmt_offset"] = userData.gmtOffset;
-        doc["steps"] = userData.steps;
-        doc["calories"] = userData.calories;
-        doc["step_goal"] = userData.stepGoal;
-        doc["calorie_goal"] = userData.calorieGoal;
-        doc["backup_time"] = timestamp;
-        doc["firmware_version"] = "5.0";
-    
-        serializeJsonPretty(doc, userFile);
-        userFile.close();
+static bool backupStoreBuffer(const uint8_t *data, size_t len, char *hashOut) {
+    BackupHasher h;
+    h.begin();
+    h.update(data, len);
+    h.finish(hashOut);
+
+    if (SD_MMC.exists(backupBlobPath(hashOut).c_str())) {
+        backupStats.lastBlobsReused++;
+        return true;
+    }
+    String tmpPath = String(SD_BACKUP_BLOBS_PATH) + "/" + hashOut + ".tmp";
+    File dst = SD_MMC.open(tmpPath.c_str(), FILE_WRITE);
+    if (!dst) return false;
+    bool ok = dst.write(data, len) == len;
+    dst.close();
+    if (!ok) {
+        SD_MMC.remove(tmpPath.c_str());
+        sdHealth.writeErrors++;
+        return false;
     }
+    backupStats.lastBytesWritten += len;
+    backupStats.lastBlobsWritten++;
+    return backupCommitBlob(tmpPath, hashOut);
+}
 
-    // Backup compass calibration
-    File compassFile = SD_MMC.open((backupDir + "/compass_calibration.txt").c_str(), FILE_WRITE);
-    if (compassFile) {
-        compassFile.printf("%.2f\n", compassNorthOffset);
-        compassFile.close();
+// Hash while copying into a temp blob in a single pass, so a file that changes
+// mid-backup can never be stored under a hash of different contents. The temp
+// is then committed under the computed hash, or dropped if that blob exists.
+static bool backupStoreFile(const char *path, char *hashOut, uint32_t &sizeOut) {
+    File src = SD_MMC.open(path, FILE_READ);
+    if (!src) {
+        sdHealth.readErrors++;
+        return false;
+    }
+    String tmpPath = String(SD_BACKUP_BLOBS_PATH) + "/pending.tmp";
+    File dst = SD_MMC.open(tmpPath.c_str(), FILE_WRITE);
+    if (!dst) {
+        src.close();
+        sdHealth.writeErrors++;
+        return false;
+    }
+
+    BackupHasher h;
+    h.begin();
+    sizeOut = 0;
+    bool ok = true;
+    while (src.available()) {
+        size_t n = src.read(backupChunk, BACKUP_CHUNK_SIZE);
+        if (n == 0) break;
+        h.update(backupChunk, n);
+        if (dst.write(backupChunk, n) != n) {
+            ok = false;
+            break;
+        }
+        sizeOut += n;
+    }
+    h.finish(hashOut);
+    src.close();
+    dst.close();
+    backupStats.lastBytesRead += sizeOut;
+
+    if (!ok) {
+        SD_MMC.remove(tmpPath.c_str());
+        sdHealth.writeErrors++;
+        return false;
+    }
+    if (SD_MMC.exists(backupBlobPath(hashOut).c_str())) {
+        SD_MMC.remove(tmpPath.c_str());
+        backupStats.lastBlobsReused++;
+        return true;
+    }
+    backupStats.lastBytesWritten += sizeOut;
+    backupStats.lastBlobsWritten++;
+    return backupCommitBlob(tmpPath, hashOut);
+}
+
+// Compiled faces are rebuilt from face.json on restore; .tmp files are
+// half-written leftovers that must never be captured
+static bool backupSkipPath(const char *path) {
+    const char *fname = strrchr(path, '/');
+    fname = fname ? fname + 1 : path;
+    size_t len = strlen(fname);
+    return strcmp(fname, FACE_BLOB_NAME) == 0 || (len >= 4 && strcmp(fname + len - 4, ".tmp") == 0);
+}
+
+static void backupAddFile(File &manifest, const char *path, uint32_t &totalBytes) {
+    if (backupSkipPath(path)) return;
+    if (backupStats.lastArtifacts >= BACKUP_MAX_ARTIFACTS) {
+        backupStats.lastTruncated++;
+        return;
+    }
+    char hash[33];
+    uint32_t size;
+    if (!backupStoreFile(path, hash, size)) {
+        backupStats.lastSkipped++;
+        return;
+    }
+    manifest.printf("+%s %lu %s\n", hash, (unsigned long)size, path);
+    backupStats.lastArtifacts++;
+    totalBytes += size;
+    vTaskDelay(1);  // Let idle run between artifacts
+}
+
+static void backupAddDirectory(File &manifest, const char *dirPath, int levels, uint32_t &totalBytes) {
+    File dir = SD_MMC.open(dirPath);
+    if (!dir || !dir.isDirectory()) return;
+
+    File entry = dir.openNextFile();
+    while (entry) {
+        String path = entry.path();
+        bool isDir = entry.isDirectory();
+        entry.close();
+        if (isDir) {
+            if (levels > 0) backupAddDirectory(manifest, path.c_str(), levels - 1, totalBytes);
+        } else {
+            backupAddFile(manifest, path.c_str(), totalBytes);
+        }
+        entry = dir.openNextFile();
+    }
+    dir.close();
+}
+
+static bool backupRunJob(BackupJob &job) {
+    backupStats.lastBytesRead = 0;
+    backupStats.lastBytesWritten = 0;
+    backupStats.lastArtifacts = 0;
+    backupStats.lastSkipped = 0;
+    backupStats.lastTruncated = 0;
+    backupStats.lastBlobsWritten = 0;
+    backupStats.lastBlobsReused = 0;
+
+    // Same second as an earlier snapshot (e.g. a repeated manual backup)
+    String mfPath = String(SD_BACKUP_SNAPSHOTS_PATH) + "/" + job.name + ".mf";
+    size_t baseLen = strlen(job.name);
+    for (int n = 2; SD_MMC.exists(mfPath.c_str()) && n < 10; n++) {
+        snprintf(job.name + baseLen, sizeof(job.name) - baseLen, "_%d", n);
+        mfPath = String(SD_BACKUP_SNAPSHOTS_PATH) + "/" + job.name + ".mf";
+    }
+    String tmpPath = String(SD_BACKUP_SNAPSHOTS_PATH) + "/" + job.name + ".tmp";
+    File manifest = SD_MMC.open(tmpPath.c_str(), FILE_WRITE);
+    if (!manifest) {
+        sdHealth.writeErrors++;
+        return false;
+    }
+    manifest.print(BACKUP_MANIFEST_MAGIC "\n");   // println() would add \r
+    manifest.printf("name=%s\n", job.name);
+    manifest.printf("auto=%d\n", job.isAuto ? 1 : 0);
+    manifest.print("firmware=5.0\n");
+
+    uint32_t totalBytes = 0;
+    char hash[33];
+
+    // Generated artifacts
+    if (job.userJson != NULL) {
+        size_t len = strlen(job.userJson);
+        if (backupStoreBuffer((const uint8_t *)job.userJson, len, hash)) {
+            manifest.printf("+%s %lu %s\n", hash, (unsigned long)len, BACKUP_ARTIFACT_USER);
+            backupStats.lastArtifacts++;
+            totalBytes += len;
+        } else {
+            backupStats.lastSkipped++;
+        }
     }
+    char compassBuf[16];
+    int compassLen = snprintf(compassBuf, sizeof(compassBuf), "%.2f\n", job.compassOffset);
+    if (backupStoreBuffer((const uint8_t *)compassBuf, compassLen, hash)) {
+        manifest.printf("+%s %d %s\n", hash, compassLen, BACKUP_ARTIFACT_COMPASS);
+        backupStats.lastArtifacts++;
+        totalBytes += compassLen;
+    } else {
+        backupStats.lastSkipped++;
+    }
+
+    // Files on the card
+    backupAddDirectory(manifest, SD_CONFIG_PATH, 0, totalBytes);
+    if (SD_MMC.exists(SD_WIFI_CONFIG)) backupAddFile(manifest, SD_WIFI_CONFIG, totalBytes);
+    backupAddDirectory(manifest, SD_FACES_CUSTOM_PATH, 1, totalBytes);
+    backupAddDirectory(manifest, SD_FACES_IMPORTED_PATH, 1, totalBytes);
+
+    manifest.printf("artifacts=%u\n", backupStats.lastArtifacts);
+    manifest.printf("bytes=%lu\n", (unsigned long)totalBytes);
+    // A partial snapshot is still worth keeping, but must say so
+    manifest.printf("skipped=%u\n", backupStats.lastSkipped);
+    manifest.printf("truncated=%u\n", backupStats.lastTruncated);
+    manifest.printf("complete=%d\n", backupStats.lastSkipped == 0 && backupStats.lastTruncated == 0 ? 1 : 0);
+    backupStats.lastBytesWritten += manifest.size();
+    manifest.close();
+
+    if (!SD_MMC.rename(tmpPath.c_str(), mfPath.c_str())) {
+        SD_MMC.remove(tmpPath.c_str());
+        sdHealth.writeErrors++;
+        return false;
+    }
+
+    return true;
+}
+
+static int compareSnapNames(const void *a, const void *b) {
+    return strcmp((const char *)a, (const char *)b);
+}
 
-    // Backup config
-    if (SD_MMC.exists(SD_CONFIG_PATH)) {
-        File srcCfg = SD_MMC.open(SD_CONFIG_PATH, FILE_READ);
-        File dstCfg = SD_MMC.open((backupDir + "/config.txt").c_str(), FILE_WRITE);
-        if (srcCfg && dstCfg) {
-            while (srcCfg.available()) {
-                dstCfg.write(srcCfg.read());
+static int compareHashes(const void *a, const void *b) {
+    return strncmp((const char *)a, (const char *)b, 32);
+}
+
+// Snapshot names (without ".mf") sorted oldest first, as they are timestamps
+static int backupListSnapshots() {
+    int count = 0;
+    File dir = SD_MMC.open(SD_BACKUP_SNAPSHOTS_PATH);
+    if (!dir || !dir.isDirectory()) return 0;
+
+    File entry = dir.openNextFile();
+    while (entry && count < BACKUP_MAX_SNAPSHOTS) {
+        const char *fname = entry.name();
+        size_t len = strlen(fname);
+        if (!entry.isDirectory() && len > 3 && len - 3 < sizeof(backupSnapNames[0]) &&
+            strcmp(fname + len - 3, ".mf") == 0) {
+            memcpy(backupSnapNames[count], fname, len - 3);
+            backupSnapNames[count][len - 3] = '\0';
+            count++;
+        }
+        entry.close();
+        entry = dir.openNextFile();
+    }
+    dir.close();
+    qsort(backupSnapNames, count, sizeof(backupSnapNames[0]), compareSnapNames);
+    return count;
+}
+
+// Drop the oldest snapshots beyond the retention limits, then sweep blobs no
+// remaining manifest references. Returns the number of snapshots kept.
+static int backupApplyRetention() {
+    int count = backupListSnapshots();
+    int autoCount = 0, manualCount = 0;
+    for (int i = 0; i < count; i++) {
+        if (strstr(backupSnapNames[i], "_auto") != NULL) autoCount++;
+        else manualCount++;
+    }
+
+    backupStats.lastPruned = 0;
+    for (int i = 0; i < count; i++) {
+        bool isAuto = strstr(backupSnapNames[i], "_auto") != NULL;
+        int &kindCount = isAuto ? autoCount : manualCount;
+        if (kindCount <= (isAuto ? BACKUP_RETAIN_AUTO : BACKUP_RETAIN_MANUAL)) continue;
+        String mfPath = String(SD_BACKUP_SNAPSHOTS_PATH) + "/" + backupSnapNames[i] + ".mf";
+        if (SD_MMC.remove(mfPath.c_str())) {
+            backupSnapNames[i][0] = '\0';
+            kindCount--;
+            backupStats.lastPruned++;
+        }
+    }
+    int kept = autoCount + manualCount;
+
+    // Mark: every hash referenced by a surviving manifest. Grown on demand -
+    // sized for the worst case it would be over a megabyte.
+    size_t maxRefs = 1024;
+    char (*refs)[32] = (char (*)[32])heap_caps_malloc(maxRefs * 32, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (refs == NULL) return kept;
+    size_t numRefs = 0;
+    bool incomplete = false;
+    for (int i = 0; i < count && !incomplete; i++) {
+        if (backupSnapNames[i][0] == '\0') continue;
+        String mfPath = String(SD_BACKUP_SNAPSHOTS_PATH) + "/" + backupSnapNames[i] + ".mf";
+        File mf = SD_MMC.open(mfPath.c_str(), FILE_READ);
+        if (!mf) {
+            incomplete = true;   // Can't prove anything is unreferenced
+            break;
+        }
+        while (mf.available()) {
+            String line = mf.readStringUntil('\n');
+            if (line.length() < 34 || line[0] != '+') continue;
+            if (numRefs == maxRefs) {
+                void *grown = heap_caps_realloc(refs, maxRefs * 2 * 32, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+                if (grown == NULL) {
+                    incomplete = true;
+                    break;
+                }
+                refs = (char (*)[32])grown;
+                maxRefs *= 2;
             }
-            srcCfg.close();
-            dstCfg.close();
+            memcpy(refs[numRefs++], line.c_str() + 1, 32);
+        }
+        mf.close();
+    }
+
+    // Sweep: blobs nobody references, plus temp files from interrupted runs
+    backupStats.lastBlobsFreed = 0;
+    if (!incomplete) {
+        qsort(refs, numRefs, 32, compareHashes);
+        File dir = SD_MMC.open(SD_BACKUP_BLOBS_PATH);
+        if (dir && dir.isDirectory()) {
+            File entry = dir.openNextFile();
+            while (entry) {
+                String path = entry.path();
+                String fname = entry.name();
+                entry.close();
+                bool referenced = fname.endsWith(".blob") && fname.length() == 37 &&
+                                  bsearch(fname.c_str(), refs, numRefs, 32, compareHashes) != NULL;
+                if (!referenced && SD_MMC.remove(path.c_str())) backupStats.lastBlobsFreed++;
+                entry = dir.openNextFile();
+            }
+            dir.close();
+        }
+    }
+    free(refs);
+    return kept;
+}
+
+static void backup_task(void *param) {
+    backupChunk = (uint8_t *)heap_caps_malloc(BACKUP_CHUNK_SIZE, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+
+    xSemaphoreTake(backupMutex, portMAX_DELAY);
+    createDirectoryIfNotExists(SD_BACKUP_BLOBS_PATH);
+    createDirectoryIfNotExists(SD_BACKUP_SNAPSHOTS_PATH);
+    totalBackups = backupListSnapshots();
+    xSemaphoreGive(backupMutex);
+
+    BackupJob job;
+    for (;;) {
+        if (xQueueReceive(backupQueue, &job, portMAX_DELAY) != pdTRUE) continue;
+
+        xSemaphoreTake(backupMutex, portMAX_DELAY);
+        uint32_t t0 = millis();
+        bool ok = backupChunk != NULL && backupRunJob(job);
+        if (ok) {
+            totalBackups = backupApplyRetention();
+            lastBackupTime = millis();
+            backupStats.runs++;
+        } else {
+            backupStats.failures++;
         }
+        // Outcome of the job createBackup() queued, for WIDGET_BACKUP_STATS
+        strncpy(backupStats.lastName, job.name, sizeof(backupStats.lastName) - 1);
+        backupStats.lastMs = millis() - t0;
+        backupStats.lastOk = ok;
+        backupStats.pending--;
+        xSemaphoreGive(backupMutex);
+        free(job.userJson);
+
+        serialLogf("[BACKUP] %s %s: %u artifacts (%u skipped, %u truncated), %lu B written in %lu ms\n",
+                         job.name, ok ? "done" : "FAILED", backupStats.lastArtifacts,
+                         backupStats.lastSkipped, backupStats.lastTruncated,
+                         (unsigned long)backupStats.lastBytesWritten, (unsigned long)backupStats.lastMs);
+    }
+}
+
+void initBackupEngine() {
+    if (!hasSD || backupQueue != NULL) return;
+    backupQueue = xQueueCreate(2, sizeof(BackupJob));
+    backupMutex = xSemaphoreCreateMutex();
+    xTaskCreatePinnedToCore(backup_task, "backup_task", 6144, NULL, tskIDLE_PRIORITY + 1, NULL, 0);
+}
+
+bool createBackup(bool isAuto) {
+    if (!hasSD || backupQueue == NULL) {
+        return false;
     }
 
-    lastBackupTime = millis();
-    totalBackups++;
+    updateSDCardHealth();
+    if (!sdHealth.healthy) {
+        return false;
+    }
 
+    BackupJob job = {};
+    job.isAuto = isAuto;
+    job.compassOffset = compassNorthOffset;
+
+    // Snapshot name doubles as its sort key, so both paths must produce the
+    // same timestamp format. Without an RTC the system clock is used: an
+    // unsynced clock reads 1970 and those snapshots sort (and prune) first.
+    if (hasRTC) {
+        RTC_DateTime dt = rtc.getDateTime();
+        snprintf(job.name, sizeof(job.name), "%04d%02d%02d_%02d%02d%02d",
+                 dt.getYear(), dt.getMonth(), dt.getDay(), dt.getHour(), dt.getMinute(), dt.getSecond());
+    } else {
+        time_t local = time(NULL) + gmtOffsetSec;
+        struct tm tm;
+        gmtime_r(&local, &tm);
+        strftime(job.name, sizeof(job.name), "%Y%m%d_%H%M%S", &tm);
+    }
+    if (isAuto) {
+        strncat(job.name, "_auto", sizeof(job.name) - strlen(job.name) - 1);
+    }
+
+    // Capture user data now; no backup_time field, so unchanged data dedups
+    DynamicJsonDocument doc(2048);
+    doc["brightness"] = userData.brightness;
+    doc["theme"] = userData.theme;
+    doc["vibration"] = userData.vibration;
+    doc["gmt_offset"] = userData.gmtOffset;
+    doc["steps"] = userData.steps;
+    doc["calories"] = userData.calories;
+    doc["step_goal"] = userData.stepGoal;
+    doc["calorie_goal"] = userData.calorieGoal;
+    doc["firmware_version"] = "5.0";
+
+    size_t len = measureJsonPretty(doc) + 1;
+    job.userJson = (char *)malloc(len);
+    if (job.userJson == NULL) return false;
+    serializeJsonPretty(doc, job.userJson, len);
+
+    backupStats.pending++;
+    if (xQueueSend(backupQueue, &job, 0) != pdTRUE) {
+        backupStats.pending--;
+        free(job.userJson);   // One already queued - nothing new to capture
+        return false;
+    }
     return true;
 }
 
-bool restoreFromBackup(const String& backupName) {
-    if (!hasSD) return false;
+static bool backupRestoreArtifact(const char *hash, uint32_t size, const char *path) {
+    File src = SD_MMC.open(backupBlobPath(hash).c_str(), FILE_READ);
+    if (!src) {
+        sdHealth.readErrors++;
+        return false;
+    }
 
-    String backupDir = String(SD_BACKUP_PATH) + "/" + backupName;
-    if (!SD_MMC.exists(backupDir.c_str())) {
+    if (strcmp(path, BACKUP_ARTIFACT_USER) == 0) {
+        DynamicJsonDocument doc(2048);
+        DeserializationError error = deserializeJson(doc, src);
+        src.close();
+        if (error) return false;
+
+        userData.brightness = doc["brightness"] | 200;
+        userData.theme = doc["theme"] | 0;
+        userData.vibration = doc["vibration"] | true;
+        userData.gmtOffset = doc["gmt_offset"] | 10;
+        userData.steps = doc["steps"] | 0;
+        userData.calories = doc["calories"] | 0;
+        userData.stepGoal = doc["step_goal"] | 10000;
+        userData.calorieGoal = doc["calorie_goal"] | 500;
+
+        displaySetBrightness(userData.brightness);
+        saveUserData();
+        return true;
+    }
+
+    if (strcmp(path, BACKUP_ARTIFACT_COMPASS) == 0) {
+        String line = src.readStringUntil('\n');
+        src.close();
+        compassNorthOffset = line.toFloat();
+
+        prefs.begin("minios", false);
+        prefs.putFloat("compassOffset", compassNorthOffset);
+        prefs.end();
+        return true;
+    }
+
+    // Plain file: recreate a face folder if it was deleted since
+    String dest = path;
+    int slash = dest.lastIndexOf('/');
+    if (slash > 0) createDirectoryIfNotExists(dest.substring(0, slash).c_str());
+    String tmpPath = dest + ".tmp";
+    File dst = SD_MMC.open(tmpPath.c_str(), FILE_WRITE);
+    if (!dst) {
+        src.close();
+        sdHealth.writeErrors++;
+        return false;
+    }
+    int32_t copied = backupCopyStream(src, dst);
+    src.close();
+    dst.close();
+    if (copied != (int32_t)size) {
+        SD_MMC.remove(tmpPath.c_str());
+        sdHealth.writeErrors++;
         return false;
     }
+    SD_MMC.remove(dest.c_str());
+    return SD_MMC.rename(tmpPath.c_str(), dest.c_str());
+}
 
+// Backups taken before the blob store existed: one directory per snapshot
+static bool restoreLegacyBackup(const String& backupDir) {
     // Restore user data
     File userFile = SD_MMC.open((backupDir + "/user_data.json").c_str(), FILE_READ);
     if (userFile) {
@@ -8411,7 +11145,7 @@ bool restoreFromBackup(const String& backupName) {
             userData.stepGoal = doc["step_goal"] | 10000;
             userData.calorieGoal = doc["calorie_goal"] | 500;
         
-            gfx->setBrightness(userData.brightness);
+            displaySetBrightness(userData.brightness);
             saveUserData();
         }
     }
@@ -8431,6 +11165,48 @@ bool restoreFromBackup(const String& backupName) {
     return true;
 }
 
+bool restoreFromBackup(const String& backupName) {
+    if (!hasSD) return false;
+
+    String mfPath = String(SD_BACKUP_SNAPSHOTS_PATH) + "/" + backupName + ".mf";
+    if (!SD_MMC.exists(mfPath.c_str())) {
+        String legacyDir = String(SD_BACKUP_PATH) + "/" + backupName;
+        if (!SD_MMC.exists(legacyDir.c_str())) {
+            return false;
+        }
+        return restoreLegacyBackup(legacyDir);
+    }
+
+    // Wait out a running snapshot rather than restore under it
+    if (backupMutex == NULL || xSemaphoreTake(backupMutex, pdMS_TO_TICKS(BACKUP_RESTORE_WAIT_MS)) != pdTRUE) {
+        return false;
+    }
+
+    bool ok = backupChunk != NULL;
+    bool facesChanged = false;
+    File mf = SD_MMC.open(mfPath.c_str(), FILE_READ);
+    if (!mf || mf.readStringUntil('\n') != BACKUP_MANIFEST_MAGIC) ok = false;
+    while (ok && mf.available()) {
+        String line = mf.readStringUntil('\n');
+        if (line.length() < 36 || line[0] != '+') continue;
+
+        // "+<hash> <size> <path>" - the path may itself contain spaces
+        int sizeEnd = line.indexOf(' ', 34);
+        if (line[33] != ' ' || sizeEnd < 0) continue;
+        String hash = line.substring(1, 33);
+        uint32_t size = line.substring(34, sizeEnd).toInt();
+        String path = line.substring(sizeEnd + 1);
+
+        if (!backupRestoreArtifact(hash.c_str(), size, path.c_str())) ok = false;
+        if (path.startsWith(SD_FACES_PATH)) facesChanged = true;
+    }
+    if (mf) mf.close();
+    xSemaphoreGive(backupMutex);
+
+    if (facesChanged) rebuildFaceIndex();
+    return ok;
+}
+
 void checkAutoBackup() {
     if (!autoBackupEnabled || !hasSD) return;
 
@@ -8442,26 +11218,56 @@ void checkAutoBackup() {
     }
 }
 
+// One line per snapshot, oldest first: "<name> <auto|manual> <artifacts> <bytes>",
+// with " incomplete" appended when artifacts were skipped or truncated
 String listBackups() {
     String result = "";
     if (!hasSD) return "NO_SD";
+    if (backupMutex == NULL || xSemaphoreTake(backupMutex, pdMS_TO_TICKS(BACKUP_RESTORE_WAIT_MS)) != pdTRUE) {
+        return "BUSY";
+    }
 
-    File dir = SD_MMC.open(SD_BACKUP_PATH);
-    if (!dir || !dir.isDirectory()) return "NO_BACKUPS";
-
-    File file = dir.openNextFile();
-    while (file) {
-        if (file.isDirectory()) {
-            result += file.name();
-            result += "\n";
+    int count = backupListSnapshots();
+    for (int i = 0; i < count; i++) {
+        String mfPath = String(SD_BACKUP_SNAPSHOTS_PATH) + "/" + backupSnapNames[i] + ".mf";
+        File mf = SD_MMC.open(mfPath.c_str(), FILE_READ);
+        if (!mf) continue;
+
+        // Header and trailer lines are key=value; skip the artifact list
+        String isAuto = "0", artifacts = "0", bytes = "0", complete = "1";
+        while (mf.available()) {
+            String line = mf.readStringUntil('\n');
+            if (line.startsWith("auto=")) isAuto = line.substring(5);
+            else if (line.startsWith("artifacts=")) artifacts = line.substring(10);
+            else if (line.startsWith("bytes=")) bytes = line.substring(6);
+            else if (line.startsWith("complete=")) complete = line.substring(9);
         }
-        file = dir.openNextFile();
+        mf.close();
+
+        result += backupSnapNames[i];
+        result += isAuto == "1" ? " auto " : " manual ";
+        result += artifacts + " " + bytes;
+        result += complete == "0" ? " incomplete\n" : "\n";
     }
-    dir.close();
+    xSemaphoreGive(backupMutex);
 
     return result.length() > 0 ? result : "NO_BACKUPS";
 }
 
+void printBackupStats() {
+    USBSerial.printf("{\"type\":\"WIDGET_BACKUP_STATS_RESPONSE\",\"snapshots\":%d,\"pending\":%u,"
+                     "\"runs\":%lu,\"failures\":%lu,\"last\":\"%s\",\"last_ok\":%s,\"last_ms\":%lu,\"bytes_read\":%lu,"
+                     "\"bytes_written\":%lu,\"artifacts\":%u,\"skipped\":%u,\"truncated\":%u,"
+                     "\"blobs_written\":%u,\"blobs_reused\":%u,\"pruned\":%u,\"blobs_freed\":%u}\n",
+                     totalBackups, (unsigned)backupStats.pending.load(), (unsigned long)backupStats.runs,
+                     (unsigned long)backupStats.failures, backupStats.lastName,
+                     backupStats.lastOk ? "true" : "false", (unsigned long)backupStats.lastMs,
+                     (unsigned long)backupStats.lastBytesRead, (unsigned long)backupStats.lastBytesWritten,
+                     backupStats.lastArtifacts, backupStats.lastSkipped, backupStats.lastTruncated,
+                     backupStats.lastBlobsWritten, backupStats.lastBlobsReused,
+                     backupStats.lastPruned, backupStats.lastBlobsFreed);
+}
+
 bool saveConfigToSD(const String& configData) {
     if (!hasSD) return false;
 
@@ -8532,18 +11338,29 @@ void sendSDHealth() {
 }
 
 void handleFaceInstall(const String& faceId, const String& faceData) {
+    const char *error = NULL;
     if (!hasSD) {
-        return;
+        error = "no_sd";
+    } else if (!faceIdValid(faceId.c_str())) {
+        error = "bad_face_id";
+    } else {
+        String facePath = String(SD_FACES_PATH) + "/custom/" + faceId;
+        SD_MMC.mkdir(facePath.c_str());
+
+        File faceFile = SD_MMC.open((facePath + "/face.json").c_str(), FILE_WRITE);
+        if (faceFile) {
+            faceFile.print(faceData);
+            faceFile.close();
+            if (!installFace(faceId.c_str())) error = "face_compile_failed";
+        } else {
+            error = "write_failed";
+        }
     }
 
-    String facePath = String(SD_FACES_PATH) + "/custom/" + faceId;
-    SD_MMC.mkdir(facePath.c_str());
-
-    File faceFile = SD_MMC.open((facePath + "/face.json").c_str(), FILE_WRITE);
-    if (faceFile) {
-        faceFile.print(faceData);
-        faceFile.close();
-    } else {
+    // Not in the index means WIDGET_SET_FACE will refuse it, so say so now
+    if (error != NULL) {
+        USBSerial.printf("{\"type\":\"WIDGET_ERROR\",\"error\":\"%s\",\"id\":\"%s\"}\n",
+                         error, faceId.c_str());
     }
 }
 
@@ -8578,19 +11395,26 @@ void processWebSerialCommand(const String& cmd) {
     else if (trimmedCmd == "WIDGET_LIST_BACKUPS") {
         String backups = listBackups();
     }
+    else if (trimmedCmd == "WIDGET_BACKUP_STATS") {
+        printBackupStats();
+    }
+    else if (trimmedCmd == "WIDGET_PROTO_STATS") {
+        printProtocolStats();
+    }
+    else if (trimmedCmd == "WIDGET_NET_STATS") {
+        printNetStats();
+    }
+    else if (trimmedCmd == "WIDGET_NET_REFRESH") {
+        netRequestRefresh(NET_EP_BIT(NET_EP_COUNT) - 1);
+    }
     else if (trimmedCmd == "WIDGET_LIST_FACES") {
-        if (hasSD) {
-            File dir = SD_MMC.open(SD_FACES_PATH);
-            if (dir) {
-                File file = dir.openNextFile();
-                while (file) {
-                    if (file.isDirectory()) {
-                    }
-                    file = dir.openNextFile();
-                }
-                dir.close();
-            }
-        }
+        printFaceList();
+    }
+    else if (trimmedCmd == "WIDGET_RESCAN_FACES") {
+        uint32_t t0 = millis();
+        rebuildFaceIndex();
+        USBSerial.printf("{\"type\":\"WIDGET_RESCAN_FACES_RESPONSE\",\"faces\":%d,\"ms\":%lu}\n",
+                         numSDFaces, (unsigned long)(millis() - t0));
     }
     else if (trimmedCmd.startsWith("WIDGET_WRITE_FACE")) {
         receivingFace = true;
@@ -8598,7 +11422,32 @@ void processWebSerialCommand(const String& cmd) {
     }
     else if (trimmedCmd.startsWith("WIDGET_SET_FACE:")) {
         String faceId = trimmedCmd.substring(16);
-        // TODO: Apply face to watch display
+        bool ok = selectFace(faceId.c_str(), true);
+        USBSerial.printf("{\"type\":\"WIDGET_SET_FACE_RESPONSE\",\"id\":\"%s\",\"ok\":%s}\n",
+                         faceId.c_str(), ok ? "true" : "false");
+    }
+    else if (trimmedCmd == "WIDGET_FACE_STATS") {
+        printFaceStats();
+    }
+    else if (trimmedCmd == "WIDGET_CARD_STATS") {
+        printCardPerfStats();
+    }
+    else if (trimmedCmd == "WIDGET_UI_QUEUE_STATS") {
+        printUIQueueStats();
+    }
+    else if (trimmedCmd == "WIDGET_UI_QUEUE_STRESS") {
+        startUIQueueStressTest();
+    }
+    else if (trimmedCmd == "WIDGET_BENCHMARK") {
+        ui_post_event(UI_EVENT_BENCHMARK);
+    }
+    else if (trimmedCmd == "WIDGET_DISPLAY_STATS") {
+        printDisplayStats();
+    }
+    else if (trimmedCmd == "WIDGET_IMU_TRACE") {
+        beginImuTraceReplay();
+        receivingImuTrace = true;
+        // CSV samples follow until END_IMU_TRACE
     }
     else if (trimmedCmd == "WIDGET_TOGGLE_AUTO_BACKUP") {
         autoBackupEnabled = !autoBackupEnabled;
@@ -8611,29 +11460,506 @@ void processWebSerialCommand(const String& cmd) {
     }
 }
 
+// 
+//  FUSION LABS BINARY FRAMES
+// 
+// A frame starts with FLB_SYNC0, a byte no text command can begin with, so
+// the same port carries both protocols: a line starting with it is parsed as
+// a frame, anything else as a text command. Layout (little endian):
+//
+//   A5 5A | type u8 | flags u8 | seq u16 | len u16 | payload[len] | crc32 u32
+//
+// The CRC (zlib polynomial) covers type..payload. Host frames carry their
+// own sequence number; device frames carry the next sequence it expects,
+// so every reply is also a cumulative ack. Data chunks are only acked every
+// FLB_ACK_EVERY frames (or with FLB_FLAG_ACK_REQ), and the host keeps at
+// most FLB_WINDOW frames unacknowledged, which keeps it within the USB RX
+// buffer. Out-of-order frames get a NAK with the expected sequence and the
+// host goes back to it; duplicates are re-acked and dropped.
+
+enum FlbStatus : uint8_t {
+    FLB_OK = 0,
+    FLB_ERR_CRC,
+    FLB_ERR_SEQ,
+    FLB_ERR_UNKNOWN,
+    FLB_ERR_ARGS,
+    FLB_ERR_STATE,       // Data/end without a matching begin, or a begin mid-transfer
+    FLB_ERR_IO,
+    FLB_ERR_VERIFY,      // Size/CRC mismatch at the end, or a face that fails to compile
+    FLB_ERR_REPLY,       // Reply too long for a device frame (firmware bug)
+};
+
+static void flbSendStatus(uint8_t type, FlbStatus status);
+static void flbEndTransfer(FlbStatus status);
+static FlbStatus flbCmdHello(const uint8_t *payload, uint16_t len, uint8_t *resp, uint16_t &respLen);
+static FlbStatus flbCmdText(const uint8_t *payload, uint16_t len, uint8_t *resp, uint16_t &respLen);
+static FlbStatus flbCmdFaceBegin(const uint8_t *payload, uint16_t len, uint8_t *resp, uint16_t &respLen);
+static FlbStatus flbCmdFirmwareBegin(const uint8_t *payload, uint16_t len, uint8_t *resp, uint16_t &respLen);
+static FlbStatus flbCmdFaceData(const uint8_t *payload, uint16_t len, uint8_t *resp, uint16_t &respLen);
+static FlbStatus flbCmdFaceEnd(const uint8_t *payload, uint16_t len, uint8_t *resp, uint16_t &respLen);
+static FlbStatus flbCmdFirmwareData(const uint8_t *payload, uint16_t len, uint8_t *resp, uint16_t &respLen);
+static FlbStatus flbCmdFirmwareEnd(const uint8_t *payload, uint16_t len, uint8_t *resp, uint16_t &respLen);
+static FlbStatus flbCmdAbort(const uint8_t *payload, uint16_t len, uint8_t *resp, uint16_t &respLen);
+
+struct FlbCommand {
+    uint8_t type;
+    bool streaming;      // Data chunks: windowed ack, reply only on error
+    FlbStatus (*handler)(const uint8_t *payload, uint16_t len, uint8_t *resp, uint16_t &respLen);
+};
+
+struct FlbTransfer {
+    uint8_t kind;            // FLB_FACE_BEGIN / FLB_FW_BEGIN, 0 = idle
+    uint32_t size;
+    uint32_t received;
+    uint32_t crc;
+    uint32_t startMs;
+    File file;
+    uint16_t stagePos;       // Face bytes waiting for a full SD block
+    char path[96];
+};
+
+struct FlbStats {
+    uint32_t frames;
+    uint32_t crcErrors;
+    uint32_t seqErrors;
+    uint32_t timeouts;
+    uint32_t lastXferBytes;
+    uint32_t lastXferMs;
+    uint8_t lastXferStatus;
+};
+
+static uint8_t flbRx[FLB_HEADER_SIZE + FLB_MAX_PAYLOAD + 4];
+static uint16_t flbRxPos = 0, flbRxNeed = FLB_HEADER_SIZE;
+static uint32_t flbRxLastByteMs = 0;
+static uint16_t flbExpectSeq = 0;
+static uint8_t flbUnacked = 0;
+static uint8_t *flbStage = NULL;      // FLB_STAGE_SIZE, allocated on first face
+static FlbTransfer flbXfer = {};
+FlbStats flbStats = {};
+
+static inline uint16_t flbGet16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+static inline uint32_t flbGet32(const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+static inline void flbPut16(uint8_t *p, uint16_t v) { p[0] = v; p[1] = v >> 8; }
+static inline void flbPut32(uint8_t *p, uint32_t v) { p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24; }
+
+static void flbSend(uint8_t type, const uint8_t *payload, uint16_t len) {
+    // Whole frame in one buffer and one write, so nothing can interleave
+    uint8_t frame[FLB_HEADER_SIZE + FLB_TX_MAX_PAYLOAD + 4];
+    static const uint8_t replyError = FLB_ERR_REPLY;
+    if (len > FLB_TX_MAX_PAYLOAD) {
+        // Never cut it short: a truncated reply with a good CRC would be trusted
+        payload = &replyError;
+        len = 1;
+    }
+    frame[0] = FLB_SYNC0;
+    frame[1] = FLB_SYNC1;
+    frame[2] = type;
+    frame[3] = 0;
+    flbPut16(frame + 4, flbExpectSeq);
+    flbPut16(frame + 6, len);
+    if (len) memcpy(frame + FLB_HEADER_SIZE, payload, len);
+    uint32_t crc = esp_rom_crc32_le(0, frame + 2, FLB_HEADER_SIZE - 2 + len);
+    flbPut32(frame + FLB_HEADER_SIZE + len, crc);
+
+    serialWrite(frame, FLB_HEADER_SIZE + len + 4);
+    flbUnacked = 0;
+}
+
+static void flbSendStatus(uint8_t type, FlbStatus status) {
+    uint8_t s = status;
+    flbSend(type, &s, 1);
+}
+
+// Face / firmware sinks
+
+static void flbEndTransfer(FlbStatus status) {
+    if (flbXfer.kind == FLB_FACE_BEGIN && flbXfer.file) {
+        flbXfer.file.close();
+        if (status != FLB_OK) {
+            String partPath = String(flbXfer.path) + ".part";
+            SD_MMC.remove(partPath.c_str());
+        }
+    } else if (flbXfer.kind == FLB_FW_BEGIN && status != FLB_OK && Update.isRunning()) {
+        Update.abort();
+    }
+    flbStats.lastXferBytes = flbXfer.received;
+    flbStats.lastXferMs = millis() - flbXfer.startMs;
+    flbStats.lastXferStatus = status;
+    flbXfer.kind = 0;
+}
+
+static bool flbFlushStage() {
+    if (flbXfer.stagePos == 0) return true;
+    size_t n = flbXfer.file.write(flbStage, flbXfer.stagePos);
+    bool ok = n == flbXfer.stagePos;
+    flbXfer.stagePos = 0;
+    if (!ok) sdHealth.writeErrors++;
+    return ok;
+}
+
+// Buffer into whole FLB_STAGE_SIZE blocks so SD writes stay sector aligned
+static bool flbFaceWrite(const uint8_t *data, size_t len) {
+    while (len > 0) {
+        size_t n = min((size_t)(FLB_STAGE_SIZE - flbXfer.stagePos), len);
+        memcpy(flbStage + flbXfer.stagePos, data, n);
+        flbXfer.stagePos += n;
+        data += n;
+        len -= n;
+        if (flbXfer.stagePos == FLB_STAGE_SIZE && !flbFlushStage()) return false;
+    }
+    return true;
+}
+
+void handleFirmwareChunk(const uint8_t* data, size_t len) {
+    if (!Update.isRunning()) return;
+    if (Update.write((uint8_t *)data, len) != len) {
+        USBSerial.printf("[FW] Write failed: %s\n", Update.errorString());
+    }
+}
+
+// Command handlers. Begin payloads: size u32, then for faces the
+// destination "<faceId>" or "<faceId>/<file>" (defaults to face.json).
+// End payloads: crc32 u32 of the whole transfer. Send a new face's assets
+// before its face.json; once face.json exists, each face END compiles the
+// face and answers FLB_ERR_VERIFY if it is not a valid face.
+
+#define FLB_HELLO_REPLY_SIZE 5
+static_assert(FLB_HELLO_REPLY_SIZE <= FLB_REPLY_MAX, "HELLO reply must fit a device frame");
+
+static FlbStatus flbCmdHello(const uint8_t *payload, uint16_t len, uint8_t *resp, uint16_t &respLen) {
+    if (flbXfer.kind) flbEndTransfer(FLB_ERR_STATE);   // Host restarted mid-transfer
+    resp[0] = FLB_VERSION;
+    resp[1] = FLB_WINDOW;
+    flbPut16(resp + 2, FLB_MAX_PAYLOAD);
+    resp[4] = FLB_ACK_EVERY;
+    respLen = FLB_HELLO_REPLY_SIZE;
+    return FLB_OK;
+}
+
+static FlbStatus flbCmdText(const uint8_t *payload, uint16_t len, uint8_t *resp, uint16_t &respLen) {
+    // Replies to text commands still go out as JSON lines
+    static char line[FLB_MAX_PAYLOAD + 1];
+    memcpy(line, payload, len);
+    line[len] = '\0';
+    processWebSerialCommand(String(line));
+    return FLB_OK;
+}
+
+static FlbStatus flbCmdFaceBegin(const uint8_t *payload, uint16_t len, uint8_t *resp, uint16_t &respLen) {
+    if (flbXfer.kind) return FLB_ERR_STATE;
+    if (!hasSD) return FLB_ERR_IO;
+    if (len < 5 || len - 4 >= 64) return FLB_ERR_ARGS;
+
+    char dest[64];
+    memcpy(dest, payload + 4, len - 4);
+    dest[len - 4] = '\0';
+    if (strstr(dest, "..") != NULL || dest[0] == '/' || dest[0] == '.') return FLB_ERR_ARGS;
+    for (const char *p = dest; *p; p++) {
+        if (!isalnum((unsigned char)*p) && strchr("_-./", *p) == NULL) return FLB_ERR_ARGS;
+    }
+
+    char *slash = strchr(dest, '/');
+    if (slash != NULL && strchr(slash + 1, '/') != NULL) return FLB_ERR_ARGS;
+    const char *fileName = "face.json";
+    if (slash != NULL) {
+        *slash = '\0';
+        fileName = slash + 1;
+        if (*fileName == '\0') return FLB_ERR_ARGS;
+    }
+    String faceDir = String(SD_FACES_CUSTOM_PATH) + "/" + dest;
+    createDirectoryIfNotExists(faceDir.c_str());
+    snprintf(flbXfer.path, sizeof(flbXfer.path), "%s/%s", faceDir.c_str(), fileName);
+
+    if (flbStage == NULL) {
+        flbStage = (uint8_t *)heap_caps_malloc(FLB_STAGE_SIZE, MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+        if (flbStage == NULL) return FLB_ERR_IO;
+    }
+    String partPath = String(flbXfer.path) + ".part";
+    flbXfer.file = SD_MMC.open(partPath.c_str(), FILE_WRITE);
+    if (!flbXfer.file) {
+        sdHealth.writeErrors++;
+        return FLB_ERR_IO;
+    }
+
+    flbXfer.kind = FLB_FACE_BEGIN;
+    flbXfer.size = flbGet32(payload);
+    flbXfer.received = 0;
+    flbXfer.crc = 0;
+    flbXfer.stagePos = 0;
+    flbXfer.startMs = millis();
+    return FLB_OK;
+}
+
+static FlbStatus flbCmdFirmwareBegin(const uint8_t *payload, uint16_t len, uint8_t *resp, uint16_t &respLen) {
+    if (flbXfer.kind) return FLB_ERR_STATE;
+    if (len < 4) return FLB_ERR_ARGS;
+    uint32_t size = flbGet32(payload);
+    if (size == 0 || !Update.begin(size, U_FLASH)) return FLB_ERR_IO;
+
+    flbXfer.kind = FLB_FW_BEGIN;
+    flbXfer.size = size;
+    flbXfer.received = 0;
+    flbXfer.crc = 0;
+    flbXfer.startMs = millis();
+    return FLB_OK;
+}
+
+// Data and end frames must match the open transfer: a FW_DATA frame must
+// never land in a face file, nor a FACE_END finalise a firmware image
+static FlbStatus flbTransferData(uint8_t kind, const uint8_t *payload, uint16_t len) {
+    if (flbXfer.kind != kind) return FLB_ERR_STATE;
+    if (flbXfer.received + len > flbXfer.size) {
+        flbEndTransfer(FLB_ERR_VERIFY);
+        return FLB_ERR_VERIFY;
+    }
+
+    if (flbXfer.kind == FLB_FACE_BEGIN) {
+        if (!flbFaceWrite(payload, len)) {
+            flbEndTransfer(FLB_ERR_IO);
+            return FLB_ERR_IO;
+        }
+    } else {
+        handleFirmwareChunk(payload, len);
+        if (Update.hasError()) {
+            flbEndTransfer(FLB_ERR_IO);
+            return FLB_ERR_IO;
+        }
+    }
+    flbXfer.crc = esp_rom_crc32_le(flbXfer.crc, payload, len);
+    flbXfer.received += len;
+    return FLB_OK;
+}
+
+static FlbStatus flbTransferEnd(uint8_t kind, const uint8_t *payload, uint16_t len) {
+    if (flbXfer.kind != kind) return FLB_ERR_STATE;
+    if (len < 4) return FLB_ERR_ARGS;
+
+    FlbStatus status = FLB_OK;
+    if (flbXfer.received != flbXfer.size || flbXfer.crc != flbGet32(payload)) status = FLB_ERR_VERIFY;
+
+    if (kind == FLB_FACE_BEGIN) {
+        if (status == FLB_OK && !flbFlushStage()) status = FLB_ERR_IO;
+        if (status == FLB_OK) {
+            flbXfer.file.close();
+            String partPath = String(flbXfer.path) + ".part";
+            SD_MMC.remove(flbXfer.path);
+            if (!SD_MMC.rename(partPath.c_str(), flbXfer.path)) status = FLB_ERR_IO;
+        }
+    } else if (status == FLB_OK && !Update.end(true)) {
+        USBSerial.printf("[FW] Update failed: %s\n", Update.errorString());
+        status = FLB_ERR_VERIFY;
+    }
+    flbEndTransfer(status);
+
+    if (status == FLB_OK && kind == FLB_FACE_BEGIN) {
+        // flbXfer.path is "<custom>/<faceId>/<file>"; an asset of a face whose
+        // face.json hasn't arrived yet has nothing to compile
+        String faceId = String(flbXfer.path + strlen(SD_FACES_CUSTOM_PATH) + 1);
+        faceId = faceId.substring(0, faceId.indexOf('/'));
+        String jsonPath = String(SD_FACES_CUSTOM_PATH) + "/" + faceId + "/face.json";
+        if (SD_MMC.exists(jsonPath.c_str()) && !installFace(faceId.c_str())) {
+            status = FLB_ERR_VERIFY;   // Stored, but not a valid face
+            flbStats.lastXferStatus = status;
+        }
+    }
+    // Firmware takes effect on the next WIDGET_REBOOT
+    return status;
+}
+
+static FlbStatus flbCmdFaceData(const uint8_t *payload, uint16_t len, uint8_t *resp, uint16_t &respLen) {
+    return flbTransferData(FLB_FACE_BEGIN, payload, len);
+}
+
+static FlbStatus flbCmdFaceEnd(const uint8_t *payload, uint16_t len, uint8_t *resp, uint16_t &respLen) {
+    return flbTransferEnd(FLB_FACE_BEGIN, payload, len);
+}
+
+static FlbStatus flbCmdFirmwareData(const uint8_t *payload, uint16_t len, uint8_t *resp, uint16_t &respLen) {
+    return flbTransferData(FLB_FW_BEGIN, payload, len);
+}
+
+static FlbStatus flbCmdFirmwareEnd(const uint8_t *payload, uint16_t len, uint8_t *resp, uint16_t &respLen) {
+    return flbTransferEnd(FLB_FW_BEGIN, payload, len);
+}
+
+static FlbStatus flbCmdAbort(const uint8_t *payload, uint16_t len, uint8_t *resp, uint16_t &respLen) {
+    if (flbXfer.kind) flbEndTransfer(FLB_ERR_STATE);
+    return FLB_OK;
+}
+
+static const FlbCommand flbCommands[] = {
+    {FLB_HELLO,      false, flbCmdHello},
+    {FLB_TEXT,       false, flbCmdText},
+    {FLB_FACE_BEGIN, false, flbCmdFaceBegin},
+    {FLB_FACE_DATA,  true,  flbCmdFaceData},
+    {FLB_FACE_END,   false, flbCmdFaceEnd},
+    {FLB_FW_BEGIN,   false, flbCmdFirmwareBegin},
+    {FLB_FW_DATA,    true,  flbCmdFirmwareData},
+    {FLB_FW_END,     false, flbCmdFirmwareEnd},
+    {FLB_ABORT,      false, flbCmdAbort},
+};
+
+static void flbHandleFrame() {
+    uint8_t type = flbRx[2];
+    uint8_t flags = flbRx[3];
+    uint16_t seq = flbGet16(flbRx + 4);
+    uint16_t len = flbGet16(flbRx + 6);
+    const uint8_t *payload = flbRx + FLB_HEADER_SIZE;
+
+    uint32_t crc = esp_rom_crc32_le(0, flbRx + 2, FLB_HEADER_SIZE - 2 + len);
+    if (crc != flbGet32(payload + len)) {
+        flbStats.crcErrors++;
+        flbSendStatus(FLB_NAK, FLB_ERR_CRC);
+        return;
+    }
+
+    // HELLO (re)starts the session at whatever sequence the host picked
+    if (type == FLB_HELLO) flbExpectSeq = seq;
+    if (seq != flbExpectSeq) {
+        flbStats.seqErrors++;
+        if ((int16_t)(seq - flbExpectSeq) < 0) flbSend(FLB_ACK, NULL, 0);   // Duplicate
+        else flbSendStatus(FLB_NAK, FLB_ERR_SEQ);
+        return;
+    }
+    flbExpectSeq++;
+    flbStats.frames++;
+
+    const FlbCommand *cmd = NULL;
+    for (const FlbCommand &c : flbCommands) {
+        if (c.type == type) {
+            cmd = &c;
+            break;
+        }
+    }
+    if (cmd == NULL) {
+        flbSendStatus(type | FLB_REPLY, FLB_ERR_UNKNOWN);
+        return;
+    }
+
+    // Handlers may write up to FLB_REPLY_MAX bytes after the status byte
+    uint8_t resp[FLB_TX_MAX_PAYLOAD];
+    uint16_t respLen = 0;
+    FlbStatus status = cmd->handler(payload, len, resp + 1, respLen);
+    if (respLen > FLB_REPLY_MAX) {
+        status = FLB_ERR_REPLY;
+        respLen = 0;
+    }
+
+    if (cmd->streaming && status == FLB_OK) {
+        if (++flbUnacked >= FLB_ACK_EVERY || (flags & FLB_FLAG_ACK_REQ)) flbSend(FLB_ACK, NULL, 0);
+        return;
+    }
+    resp[0] = status;
+    flbSend(type | FLB_REPLY, resp, respLen + 1);
+}
+
+// Feed frame bytes; returns how many were used. Payloads are copied in bulk.
+static size_t flbConsume(const uint8_t *data, size_t len) {
+    size_t used = 0;
+    while (used < len) {
+        if (flbRxPos < FLB_HEADER_SIZE) {
+            uint8_t c = data[used++];
+            if ((flbRxPos == 0 && c != FLB_SYNC0) || (flbRxPos == 1 && c != FLB_SYNC1)) {
+                flbRxPos = 0;    // Lost sync: back to text mode
+                return used;
+            }
+            flbRx[flbRxPos++] = c;
+            if (flbRxPos == FLB_HEADER_SIZE) {
+                uint16_t plen = flbGet16(flbRx + 6);
+                if (plen > FLB_MAX_PAYLOAD) {
+                    flbStats.crcErrors++;
+                    flbRxPos = 0;
+                    flbSendStatus(FLB_NAK, FLB_ERR_CRC);
+                    return used;
+                }
+                flbRxNeed = FLB_HEADER_SIZE + plen + 4;
+            }
+            continue;
+        }
+
+        size_t n = min((size_t)(flbRxNeed - flbRxPos), len - used);
+        memcpy(flbRx + flbRxPos, data + used, n);
+        flbRxPos += n;
+        used += n;
+        if (flbRxPos == flbRxNeed) {
+            flbHandleFrame();
+            flbRxPos = 0;
+            return used;
+        }
+    }
+    return used;
+}
+
+void printProtocolStats() {
+    uint32_t kbps = flbStats.lastXferMs ? flbStats.lastXferBytes / flbStats.lastXferMs : 0;
+    USBSerial.printf("{\"type\":\"WIDGET_PROTO_STATS_RESPONSE\",\"frames\":%lu,\"crc_errors\":%lu,"
+                     "\"seq_errors\":%lu,\"timeouts\":%lu,\"last_xfer_bytes\":%lu,\"last_xfer_ms\":%lu,"
+                     "\"last_xfer_kbps\":%lu,\"last_xfer_status\":%u}\n",
+                     (unsigned long)flbStats.frames, (unsigned long)flbStats.crcErrors,
+                     (unsigned long)flbStats.seqErrors, (unsigned long)flbStats.timeouts,
+                     (unsigned long)flbStats.lastXferBytes, (unsigned long)flbStats.lastXferMs,
+                     (unsigned long)kbps, flbStats.lastXferStatus);
+}
+
+static void handleWebSerialLine(String cmd) {
+    if (receivingImuTrace) {
+        cmd.trim();
+        if (cmd == "END_IMU_TRACE") {
+            receivingImuTrace = false;
+            endImuTraceReplay();
+        } else {
+            feedImuTraceLine(cmd);
+        }
+    } else if (receivingFace) {
+        if (cmd == "END_FACE_DATA") {
+            receivingFace = false;
+        } else if (currentFaceId.length() == 0) {
+            currentFaceId = cmd;
+        } else {
+            handleFaceInstall(currentFaceId, cmd);
+            currentFaceId = "";
+        }
+    } else {
+        processWebSerialCommand(cmd);
+    }
+}
+
 void handleFusionLabsProtocol() {
-    while (USBSerial.available()) {
-        char c = USBSerial.read();
-    
-        if (c == '\n') {
-            webSerialBuffer[webSerialBufferIndex] = '\0';
-            String cmd = String(webSerialBuffer);
-            webSerialBufferIndex = 0;
-        
-            if (receivingFace) {
-                if (cmd == "END_FACE_DATA") {
-                    receivingFace = false;
-                } else if (currentFaceId.length() == 0) {
-                    currentFaceId = cmd;
-                } else {
-                    handleFaceInstall(currentFaceId, cmd);
-                    currentFaceId = "";
+    // A stalled host must not leave the port stuck in frame mode
+    if (flbRxPos > 0 && millis() - flbRxLastByteMs > FLB_FRAME_TIMEOUT_MS) {
+        flbStats.timeouts++;
+        flbRxPos = 0;
+    }
+
+    uint8_t rx[256];
+    int avail;
+    while ((avail = USBSerial.available()) > 0) {
+        size_t n = USBSerial.read(rx, min((size_t)avail, sizeof(rx)));
+        flbRxLastByteMs = millis();
+
+        for (size_t i = 0; i < n; ) {
+            if (flbRxPos > 0 || (webSerialBufferIndex == 0 && rx[i] == FLB_SYNC0)) {
+                i += flbConsume(rx + i, n - i);
+                continue;
+            }
+
+            char c = rx[i++];
+            if (c == '\n') {
+                webSerialBuffer[webSerialBufferIndex] = '\0';
+                webSerialBufferIndex = 0;
+                if (webSerialOverflow) {
+                    // Acting on a truncated line (e.g. a face) would corrupt it
+                    webSerialOverflow = false;
+                    USBSerial.printf("{\"type\":\"WIDGET_ERROR\",\"error\":\"line_too_long\",\"max\":%d}\n",
+                                     WEB_SERIAL_BUFFER_SIZE - 1);
+                    continue;
                 }
+                handleWebSerialLine(String(webSerialBuffer));
+            } else if (webSerialBufferIndex < WEB_SERIAL_BUFFER_SIZE - 1) {
+                webSerialBuffer[webSerialBufferIndex++] = c;
             } else {
-                processWebSerialCommand(cmd);
+                webSerialOverflow = true;
             }
-        } else if (webSerialBufferIndex < WEB_SERIAL_BUFFER_SIZE - 1) {
-            webSerialBuffer[webSerialBufferIndex++] = c;
         }
     }
 }
@@ -8731,7 +12057,9 @@ void panic_recover() {
 
 void handle_ui_event(UIEventType event, int param1, int param2) {
     // FIX 8: Debug marker
-    USBSerial.printf("[UI_EVENT] Type: %d, Params: %d, %d\n", event, param1, param2);
+    if (event != UI_EVENT_PROBE) {
+        USBSerial.printf("[UI_EVENT] Type: %d, Params: %d, %d\n", event, param1, param2);
+    }
     
     switch (event) {
         case UI_EVENT_NAV_LEFT:
@@ -8774,7 +12102,7 @@ void handle_ui_event(UIEventType event, int param1, int param2) {
             
         case UI_EVENT_REFRESH:
             if (!isTransitioning && screenOn) {
-                navigateTo(currentCategory, currentSubCard);
+                refreshCurrentCard();
             }
             break;
             
@@ -8786,6 +12114,26 @@ void handle_ui_event(UIEventType event, int param1, int param2) {
             shutdownDevice();
             break;
             
+        case UI_EVENT_NEXT_CATEGORY:
+            if (!isTransitioning && canNavigate()) {
+                currentCategory = (currentCategory + 1) % NUM_CATEGORIES;
+                currentSubCard = 0;
+                navigateTo(currentCategory, currentSubCard);
+            }
+            break;
+            
+        case UI_EVENT_PROBE:
+            uiStressProbesHandled++;
+            break;
+            
+        case UI_EVENT_BENCHMARK:
+            runCardBenchmark();
+            break;
+            
+        case UI_EVENT_FACE_CHANGED:
+            applyPendingFace();
+            break;
+            
         default:
             break;
     }
@@ -8799,7 +12147,7 @@ void handle_ui_event(UIEventType event, int param1, int param2) {
 // ═══════════════════════════════════════════════════════════════════════════
 
 void ui_task(void *pvParameters) {
-    USBSerial.println("[UI_TASK] Started on Core 1");
+    serialLogf("[UI_TASK] Started on Core 1\n");
     
     // FIX 7: Add this task to watchdog (ESP-IDF v5.x API)
     esp_task_wdt_add(xTaskGetCurrentTaskHandle());
@@ -8811,30 +12159,262 @@ void ui_task(void *pvParameters) {
         // FIX 9: Update response timestamp
         last_lvgl_response = millis();
         
-        // Handle LVGL tasks
-        lv_task_handler();
+        // Handle LVGL tasks (touch read happens in here and may post input)
+        uint32_t idleMs = lv_task_handler();
         
-        // Process any pending UI events
-        if (ui_event != UI_EVENT_NONE) {
-            UIEventType current_event = ui_event;
-            int p1 = ui_event_param1;
-            int p2 = ui_event_param2;
-            
-            // Clear event before processing (prevents re-entry)
-            ui_event = UI_EVENT_NONE;
-            ui_event_param1 = 0;
-            ui_event_param2 = 0;
-            
-            // Handle the event
-            handle_ui_event(current_event, p1, p2);
+        // Input first, in the order it was posted
+        uint32_t depth = ui_event_queue_depth();
+        if (depth > uiQueueStats.maxDepth) uiQueueStats.maxDepth = depth;
+        
+        UIEvent ev;
+        while (ui_pop_event(ev)) {
+            // Stress-test probes would flood the real input p50/p99 window
+            if (ev.type != UI_EVENT_PROBE) {
+                ui_record_latency(uiInputLatencyUs, uiInputLatencyCount, ev.postedUs);
+            }
+            uiQueueStats.handled++;
+            handle_ui_event(ev.type, ev.param1, ev.param2);
+        }
+        
+        // Then at most one refresh, however many were requested
+        if (ui_refresh_pending.exchange(false, std::memory_order_acq_rel)) {
+            ui_record_latency(uiRefreshLatencyUs, uiRefreshLatencyCount,
+                              ui_refresh_posted_us.load(std::memory_order_relaxed));
+            uiQueueStats.refreshHandled++;
+            handle_ui_event(UI_EVENT_REFRESH, 0, 0);
         }
         
         // Check for stuck transitions
         checkTransitionTimeout();
         
-        // Small delay to prevent CPU hogging
-        vTaskDelay(pdMS_TO_TICKS(5));
+        // Sleep until an event is posted or the next LVGL timer is due
+        if (idleMs > UI_TASK_MAX_IDLE_MS) idleMs = UI_TASK_MAX_IDLE_MS;
+        if (idleMs < 1) idleMs = 1;
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(idleMs));
+    }
+}
+
+// Percentile over the recent latency window (copy + insertion sort, 128 samples max)
+static uint32_t uiLatencyPercentile(const uint32_t *window, uint32_t count, int pct) {
+    uint32_t n = count < UI_LATENCY_WINDOW ? count : UI_LATENCY_WINDOW;
+    if (n == 0) return 0;
+    
+    uint32_t sorted[UI_LATENCY_WINDOW];
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t v = window[i];
+        uint32_t j = i;
+        while (j > 0 && sorted[j - 1] > v) {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = v;
+    }
+    return sorted[((n - 1) * pct) / 100];
+}
+
+void printUIQueueStats() {
+    USBSerial.printf("{\"type\":\"WIDGET_UI_QUEUE_STATS_RESPONSE\",\"posted\":%lu,\"handled\":%lu,"
+                     "\"overflows\":%lu,\"max_depth\":%lu,\"refresh_posted\":%lu,"
+                     "\"refresh_coalesced\":%lu,\"refresh_handled\":%lu,"
+                     "\"input_p50_us\":%lu,\"input_p99_us\":%lu,"
+                     "\"refresh_p50_us\":%lu,\"refresh_p99_us\":%lu}\n",
+                     (unsigned long)uiQueueStats.posted.load(),
+                     (unsigned long)uiQueueStats.handled,
+                     (unsigned long)uiQueueStats.overflows.load(),
+                     (unsigned long)uiQueueStats.maxDepth,
+                     (unsigned long)uiQueueStats.refreshPosted.load(),
+                     (unsigned long)uiQueueStats.refreshCoalesced.load(),
+                     (unsigned long)uiQueueStats.refreshHandled,
+                     (unsigned long)uiLatencyPercentile(uiInputLatencyUs, uiInputLatencyCount, 50),
+                     (unsigned long)uiLatencyPercentile(uiInputLatencyUs, uiInputLatencyCount, 99),
+                     (unsigned long)uiLatencyPercentile(uiRefreshLatencyUs, uiRefreshLatencyCount, 50),
+                     (unsigned long)uiLatencyPercentile(uiRefreshLatencyUs, uiRefreshLatencyCount, 99));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//  UI QUEUE STRESS TEST - One producer per core hammers the queue with
+//  probe events (plus refresh spam) while ui_task keeps running normally.
+//  Every accepted probe must come out the other end; rejected posts are
+//  counted as overflows and retried.
+// ═══════════════════════════════════════════════════════════════════════════
+
+#define UI_STRESS_PROBES_PER_TASK 1000
+
+static std::atomic<int> uiStressProducersLeft(0);
+static std::atomic<uint32_t> uiStressAccepted(0);
+
+static void ui_queue_stress_task(void *pvParameters) {
+    uint32_t overflowsBefore = uiQueueStats.overflows.load();
+    
+    for (int i = 0; i < UI_STRESS_PROBES_PER_TASK; i++) {
+        while (!ui_post_event(UI_EVENT_PROBE, xPortGetCoreID(), i)) {
+            vTaskDelay(1);
+        }
+        uiStressAccepted.fetch_add(1);
+        if ((i & 7) == 0) ui_post_event(UI_EVENT_REFRESH);
+        if ((i & 63) == 0) vTaskDelay(1);
+    }
+    
+    // Last producer out waits for ui_task to drain, then reports
+    if (uiStressProducersLeft.fetch_sub(1) == 1) {
+        uint32_t start = millis();
+        while (uiStressProbesHandled < uiStressAccepted.load() && millis() - start < 2000) {
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
+        serialLogf("{\"type\":\"WIDGET_UI_QUEUE_STRESS_RESPONSE\",\"accepted\":%lu,"
+                         "\"handled\":%lu,\"lost\":%ld,\"overflows_since_start\":%lu}\n",
+                         (unsigned long)uiStressAccepted.load(),
+                         (unsigned long)uiStressProbesHandled,
+                         (long)(uiStressAccepted.load() - uiStressProbesHandled),
+                         (unsigned long)(uiQueueStats.overflows.load() - overflowsBefore));
+        printUIQueueStats();
+    }
+    vTaskDelete(NULL);
+}
+
+void startUIQueueStressTest() {
+    if (uiStressProducersLeft.load() != 0) return;  // Already running
+    
+    uiStressAccepted.store(0);
+    uiStressProbesHandled = 0;
+    uiStressProducersLeft.store(2);
+    xTaskCreatePinnedToCore(ui_queue_stress_task, "ui_stress0", 3072, NULL, 1, NULL, 0);
+    xTaskCreatePinnedToCore(ui_queue_stress_task, "ui_stress1", 3072, NULL, 1, NULL, 1);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════
+//  CARD BENCHMARK - Walks every card in maxSubCards[] and replays a scripted
+//  swipe tour, printing one JSON line per card/gesture so runs from two
+//  firmware releases can be diffed. Runs inside ui_task (UI_EVENT_BENCHMARK).
+//  Lines are prefixed "type":"BENCH_..." - filter on that, [NAV] debug
+//  output from navigateTo() is interleaved. This is the on-device runner
+//  only; there is no host (off-device) build of the sketch yet.
+// ═══════════════════════════════════════════════════════════════════════════
+
+#define BENCH_UPDATE_FRAMES 10      // Steady-state refreshes measured per card
+
+struct BenchFrame {
+    uint32_t us;                    // Render + flush time
+    uint32_t px;                    // Pixels flushed
+};
+
+static BenchFrame benchRenderFrame(bool full);
+
+// Render synchronously, optionally forcing a full-screen redraw
+static BenchFrame benchRenderFrame(bool full) {
+    if (full) lv_obj_invalidate(lv_scr_act());
+    BenchFrame f;
+    uint32_t px = flushedPixelCount;
+    uint32_t t = micros();
+    lv_refr_now(NULL);
+    displayWaitFlushDone();         // Count the last in-flight transfer too
+    f.us = micros() - t;
+    f.px = flushedPixelCount - px;
+    return f;
+}
+
+static void benchHeapStats(uint32_t &used, uint32_t &maxUsed) {
+#if LV_MEM_CUSTOM == 0
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    used = mon.total_size - mon.free_size;
+    maxUsed = mon.max_used;
+#else
+    used = 0;
+    maxUsed = 0;
+#endif
+}
+
+// Replay one gesture exactly as the touch driver would post it
+static void benchGesture(UIEventType gesture, const char *name) {
+    int fromCat = currentCategory, fromSub = currentSubCard;
+
+    // Skip the human-speed cooldown/transition guards
+    isTransitioning = false;
+    navigationLocked = false;
+    lastNavigationMs = 0;
+
+    uint32_t t = micros();
+    handle_ui_event(gesture, 0, 0);
+    uint32_t handleUs = micros() - t;
+    BenchFrame f = benchRenderFrame(false);
+
+    USBSerial.printf("{\"type\":\"BENCH_GESTURE\",\"gesture\":\"%s\",\"from\":[%d,%d],\"to\":[%d,%d],"
+                     "\"handle_us\":%lu,\"frame_us\":%lu,\"flushed_px\":%lu}\n",
+                     name, fromCat, fromSub, currentCategory, currentSubCard,
+                     (unsigned long)handleUs, (unsigned long)f.us, (unsigned long)f.px);
+    esp_task_wdt_reset();
+}
+
+void runCardBenchmark() {
+    int savedCategory = currentCategory;
+    int savedSubCard = currentSubCard;
+    uint32_t benchStartMs = millis();
+
+    USBSerial.printf("{\"type\":\"BENCH_START\",\"version\":\"%s\",\"build\":\"%s\",\"lcd\":[%d,%d]}\n",
+                     WIDGET_OS_VERSION, WIDGET_OS_BUILD, LCD_WIDTH, LCD_HEIGHT);
+
+    // Pass 1: build + full frame + steady-state refreshes for every card
+    for (int c = 0; c < NUM_CATEGORIES; c++) {
+        for (int s = 0; s < maxSubCards[c]; s++) {
+            esp_task_wdt_reset();
+            currentCategory = c;
+            currentSubCard = s;
+
+            uint32_t t = micros();
+            navigateTo(c, s);
+            uint32_t buildUs = micros() - t;
+            BenchFrame full = benchRenderFrame(true);
+            uint32_t objs = countObjTree(lv_scr_act()) - 1;
+
+            uint32_t updateUs = 0, updateFrameUs = 0, updatePx = 0;
+            for (int i = 0; i < BENCH_UPDATE_FRAMES; i++) {
+                t = micros();
+                refreshCurrentCard();
+                updateUs += micros() - t;
+                BenchFrame f = benchRenderFrame(false);
+                updateFrameUs += f.us;
+                updatePx += f.px;
+            }
+
+            uint32_t heapUsed, heapMax;
+            benchHeapStats(heapUsed, heapMax);
+
+            USBSerial.printf("{\"type\":\"BENCH_CARD\",\"cat\":%d,\"sub\":%d,\"build_us\":%lu,"
+                             "\"frame_us\":%lu,\"flushed_px\":%lu,\"objs\":%lu,"
+                             "\"update_us\":%lu,\"update_frame_us\":%lu,\"update_px\":%lu,"
+                             "\"has_hook\":%s,\"heap_used\":%lu,\"heap_hwm\":%lu}\n",
+                             c, s, (unsigned long)buildUs,
+                             (unsigned long)full.us, (unsigned long)full.px, (unsigned long)objs,
+                             (unsigned long)(updateUs / BENCH_UPDATE_FRAMES),
+                             (unsigned long)(updateFrameUs / BENCH_UPDATE_FRAMES),
+                             (unsigned long)(updatePx / BENCH_UPDATE_FRAMES),
+                             activeCardUpdate != NULL ? "true" : "false",
+                             (unsigned long)heapUsed, (unsigned long)heapMax);
+        }
     }
+
+    // Pass 2: scripted swipe tour - down through each stack, back up, next category
+    currentCategory = CAT_CLOCK;
+    currentSubCard = 0;
+    navigateTo(currentCategory, currentSubCard);
+    for (int c = 0; c < NUM_CATEGORIES; c++) {
+        for (int s = 1; s < maxSubCards[currentCategory]; s++) benchGesture(UI_EVENT_NAV_UP, "swipe_down");
+        while (currentSubCard > 0) benchGesture(UI_EVENT_NAV_DOWN, "swipe_up");
+        benchGesture(UI_EVENT_NAV_RIGHT, "swipe_left");
+    }
+
+    uint32_t heapUsed, heapMax;
+    benchHeapStats(heapUsed, heapMax);
+    USBSerial.printf("{\"type\":\"BENCH_DONE\",\"total_ms\":%lu,\"heap_used\":%lu,\"heap_hwm\":%lu}\n",
+                     (unsigned long)(millis() - benchStartMs), (unsigned long)heapUsed, (unsigned long)heapMax);
+
+    // Put the user back where they were
+    isTransitioning = false;
+    lastNavigationMs = 0;
+    currentCategory = savedCategory;
+    currentSubCard = savedSubCard;
+    navigateTo(currentCategory, currentSubCard);
 }
 
 // ═══════════════════════════════════════════════════════════════════════════
@@ -8853,8 +12433,8 @@ void backlight_manager() {
     unsigned long timeout = batterySaverMode ? SCREEN_OFF_TIMEOUT_SAVER_MS : SCREEN_OFF_TIMEOUT_MS;
     
     if (screenOn && millis() - last_ui_activity > timeout) {
-        // Set event flag instead of directly calling screenOff
-        ui_event = UI_EVENT_SCREEN_OFF;
+        // Post event instead of directly calling screenOff
+        ui_post_event(UI_EVENT_SCREEN_OFF);
     }
 }
 
@@ -8872,7 +12452,9 @@ void check_lvgl_stall() {
 
 
 void setup() {
+    USBSerial.setRxBufferSize(FLB_RX_BUFFER_SIZE);  // Room for a full window of frames
     USBSerial.begin(115200);
+    serialMutex = xSemaphoreCreateMutex();
     delay(100);
 
     USBSerial.println("═══════════════════════════════════════════════════════════════");
@@ -8936,6 +12518,7 @@ void setup() {
         qmi.enableAccelerometer();
         qmi.enableGyroscope();
         hasIMU = true;
+        startSensorTask();
     } else {
     }
 
@@ -8943,9 +12526,11 @@ void setup() {
     if (rtc.begin(Wire, IIC_SDA, IIC_SCL)) {
         hasRTC = true;
     
-        // Set initial time (will be overwritten by NTP if WiFi connects)
+        // Only set a placeholder if the RTC lost its time; NTP corrects it later
         // Format: setDateTime(year, month, day, hour, minute, second)
-        rtc.setDateTime(2025, 1, 26, 12, 0, 0);
+        if (rtc.getDateTime().getYear() < 2025) {
+            rtc.setDateTime(2025, 1, 26, 12, 0, 0);
+        }
     
     } else {
     }
@@ -8971,6 +12556,8 @@ void setup() {
     
         // Initialize Fusion Labs compatible folder structure
         initSDCardStructure();
+        initBackupEngine();
+        loadFaceIndex();
     
         // Update SD health stats
         updateSDCardHealth();
@@ -9006,46 +12593,58 @@ void setup() {
         }
     }
 
-    // Connect to WiFi - Use smart connection system
-    // This tries known networks first, then scans for free open networks
-    smartWiFiConnect();
-
-    if (wifiConnected) {
-        // Sync time via NTP
-        configTime(gmtOffsetSec, DAYLIGHT_OFFSET_SEC, NTP_SERVER);
-    
-        // Wait a bit for NTP sync
-        delay(2000);
-    
-        // Update RTC from NTP if available
-        if (hasRTC) {
-            struct tm timeinfo;
-            if (getLocalTime(&timeinfo)) {
-                rtc.setDateTime(timeinfo.tm_year + 1900, timeinfo.tm_mon + 1, timeinfo.tm_mday,
-                               timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
-                ntpSyncedOnce = true;
-                lastNTPSync = millis();
-            }
-        }
-    
-        // Fetch initial data - first auto-detect location then get weather
-        fetchLocationFromIP();  // This will also call fetchWeatherData() after getting location
-    }
+    // Staged boot: no network here. The system clock starts from the RTC
+    // (which holds local time) so cache ages are right before NTP, and the
+    // last good responses from SD fill the cards for the first frame.
+    // net_task connects and refreshes whatever is stale once the UI is up.
+    if (hasRTC) {
+        RTC_DateTime dt = rtc.getDateTime();
+        struct tm local = {};
+        local.tm_year = dt.getYear() - 1900;
+        local.tm_mon = dt.getMonth() - 1;
+        local.tm_mday = dt.getDay();
+        local.tm_hour = dt.getHour();
+        local.tm_min = dt.getMinute();
+        local.tm_sec = dt.getSecond();
+        struct timeval tv = { mktime(&local) - gmtOffsetSec, 0 };  // TZ unset: mktime is UTC
+        settimeofday(&tv, NULL);
+    }
+    loadNetCache();
 
     // Initialize LVGL
     lv_init();
 
-    // Allocate draw buffers
-    size_t buf_size = LCD_WIDTH * 50 * sizeof(lv_color_t);
-    buf1 = (lv_color_t *)heap_caps_malloc(buf_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
-    buf2 = (lv_color_t *)heap_caps_malloc(buf_size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    // Allocate draw buffers (see DISP_BUF_STRATEGY)
+#if DISP_BUF_STRATEGY == DISP_BUF_INTERNAL_50
+    uint32_t bufLines = 50;
+    uint32_t bufCaps = MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA;
+#elif DISP_BUF_STRATEGY == DISP_BUF_FULL_FRAME
+    uint32_t bufLines = LCD_HEIGHT;
+    uint32_t bufCaps = MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT;
+#else
+    uint32_t bufLines = DISP_STRIPE_LINES;
+    uint32_t bufCaps = MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT;
+#endif
+    size_t buf_size = LCD_WIDTH * bufLines * sizeof(lv_color_t);
+    buf1 = (lv_color_t *)heap_caps_malloc(buf_size, bufCaps);
+    buf2 = (lv_color_t *)heap_caps_malloc(buf_size, bufCaps);
 
     if (!buf1 || !buf2) {
+        // Fall back to 50 lines in internal RAM
+        if (buf1) heap_caps_free(buf1);
+        if (buf2) heap_caps_free(buf2);
+        bufLines = 50;
+        buf_size = LCD_WIDTH * bufLines * sizeof(lv_color_t);
         buf1 = (lv_color_t *)heap_caps_malloc(buf_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
         buf2 = (lv_color_t *)heap_caps_malloc(buf_size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
     }
 
-    lv_disp_draw_buf_init(&draw_buf, buf1, buf2, LCD_WIDTH * 50);
+    lv_disp_draw_buf_init(&draw_buf, buf1, buf2, LCD_WIDTH * bufLines);
+    USBSerial.printf("[DISPLAY] 2 x %lu-line draw buffers, %s flush\n",
+                     (unsigned long)bufLines, DISP_ASYNC_FLUSH ? "async" : "blocking");
+
+    // Start the transport before LVGL can flush anything
+    displayTransport->begin();
 
     // Register display driver
     static lv_disp_drv_t disp_drv;
@@ -9053,8 +12652,16 @@ void setup() {
     disp_drv.hor_res = LCD_WIDTH;
     disp_drv.ver_res = LCD_HEIGHT;
     disp_drv.flush_cb = my_disp_flush;
+    disp_drv.rounder_cb = my_disp_rounder;
+    disp_drv.wait_cb = my_disp_wait;
     disp_drv.draw_buf = &draw_buf;
+#if DISP_MERGE_AREAS
+    // Merge nearby dirty areas before each refresh
+    lv_disp_t *disp = lv_disp_drv_register(&disp_drv);
+    lv_timer_set_cb(disp->refr_timer, disp_refr_timer_cb);
+#else
     lv_disp_drv_register(&disp_drv);
+#endif
 
     // Register touch input
     static lv_indev_drv_t indev_drv;
@@ -9084,6 +12691,8 @@ void setup() {
     //  FIX 1: CREATE UI TASK - Single thread for ALL LVGL operations
     // ═══════════════════════════════════════════════════════════════════════
 
+    ui_event_queue_init();
+
     xTaskCreatePinnedToCore(
         ui_task,        // Task function
         "ui_task",      // Task name
@@ -9096,8 +12705,14 @@ void setup() {
 
     USBSerial.println("[UI_TASK] Created with 10KB stack on Core 1");
 
+    // Saved custom face, if any, replaces the digital clock card
+    restoreSavedFace();
+
     // Show initial screen (via event system for thread safety)
-    ui_event = UI_EVENT_REFRESH;
+    ui_post_event(UI_EVENT_REFRESH);
+
+    // WiFi, NTP and fetches run on core 0 from here on
+    startNetworkService();
 
     USBSerial.println("═══════════════════════════════════════════════════════════════");
     USBSerial.println("  Setup complete - All 9 LVGL fixes active");
@@ -9135,6 +12750,7 @@ void loop() {
         clockMinute = dt.getMinute();
         clockSecond = dt.getSecond();
         currentDay = dt.getDay();
+        currentWeekday = dt.getWeek();
     }
 
     // FIX 1: REMOVED lv_task_handler() - now handled by ui_task
@@ -9146,7 +12762,7 @@ void loop() {
         checkIdentityUnlocks();
     }
 
-    // Update sensors (50Hz) - no LVGL calls
+    // Pick up the sensor task's latest results (50Hz) - no LVGL calls
     if (millis() - lastStepUpdate >= 20) {
         lastStepUpdate = millis();
         updateSensorFusion();
@@ -9185,17 +12801,8 @@ void loop() {
         }
     }
 
-    // Update weather (every 30 minutes)
-    if (wifiConnected && millis() - lastWeatherUpdate >= 1800000) {
-        fetchWeatherData();
-        fetchSunriseSunsetData();
-        fetchCurrencyRates();
-    }
-
-    // 
-    // AUTOMATIC FREE WIFI - Check connection and auto-reconnect
-    // 
-    checkWiFiConnection();
+    // Weather, sun times, rates and NTP arrive from net_task (see NETWORK SERVICE)
+    applyNetResults(true);
 
     // Auto-save (every 2 hours)
     if (millis() - lastSaveTime >= SAVE_INTERVAL_MS) {
@@ -9222,7 +12829,7 @@ void loop() {
         }
         // FIX 1: Use event instead of direct navigation
         if (screenOn && currentCategory == CAT_MEDIA && currentSubCard == 0 && !isTransitioning) {
-            ui_event = UI_EVENT_REFRESH;
+            ui_post_event(UI_EVENT_REFRESH);
         }
     }
 
@@ -9234,7 +12841,7 @@ void loop() {
             timerNotificationActive = true;
         }
         if (screenOn && currentCategory == CAT_TIMER && currentSubCard == 0 && !isTransitioning) {
-            ui_event = UI_EVENT_REFRESH;
+            ui_post_event(UI_EVENT_REFRESH);
         }
     }
 
@@ -9243,7 +12850,7 @@ void loop() {
         static unsigned long lastStopwatchRefresh = 0;
         if (millis() - lastStopwatchRefresh >= 100) {
             lastStopwatchRefresh = millis();
-            ui_event = UI_EVENT_REFRESH;
+            ui_post_event(UI_EVENT_REFRESH);
         }
     }
 
@@ -9252,16 +12859,17 @@ void loop() {
         static unsigned long lastBreatheRefresh = 0;
         if (millis() - lastBreatheRefresh >= 100) {
             lastBreatheRefresh = millis();
-            ui_event = UI_EVENT_REFRESH;
+            ui_post_event(UI_EVENT_REFRESH);
         }
     }
 
-    // Clock refresh - every 5 seconds (via event)
+    // Clock refresh - every 5 seconds, or every second for a face with seconds (via event)
     if (screenOn && currentCategory == CAT_CLOCK && !isTransitioning) {
         static unsigned long lastClockRefresh = 0;
-        if (millis() - lastClockRefresh >= 5000) {
+        unsigned long clockInterval = (currentSubCard == 0 && faceTicksSeconds) ? 1000 : 5000;
+        if (millis() - lastClockRefresh >= clockInterval) {
             lastClockRefresh = millis();
-            ui_event = UI_EVENT_REFRESH;
+            ui_post_event(UI_EVENT_REFRESH);
         }
     }
 
@@ -9270,7 +12878,7 @@ void loop() {
         static unsigned long lastCompassRefresh = 0;
         if (millis() - lastCompassRefresh >= 500) {
             lastCompassRefresh = millis();
-            ui_event = UI_EVENT_REFRESH;
+            ui_post_event(UI_EVENT_REFRESH);
         }
     }
 
@@ -9279,18 +12887,8 @@ void loop() {
         static unsigned long lastDinoRefresh = 0;
         if (millis() - lastDinoRefresh >= 50) {
             lastDinoRefresh = millis();
-            ui_event = UI_EVENT_REFRESH;
-        }
-    }
-
-    // NTP periodic re-sync (every hour while WiFi is connected)
-    if (wifiConnected && hasRTC && millis() - lastNTPSync >= NTP_RESYNC_INTERVAL_MS) {
-        struct tm timeinfo;
-        if (getLocalTime(&timeinfo)) {
-            rtc.setDateTime(timeinfo.tm_year + 1900, timeinfo.tm_mon + 1, timeinfo.tm_mday,
-                           timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
+            ui_post_event(UI_EVENT_REFRESH);
         }
-        lastNTPSync = millis();
     }
 
     // Main loop delay - UI handled by separate task
@@ -9318,7 +12916,7 @@ void loop() {
  *  ✅ FIX 4: Touch Driver Rules
  *     - my_touchpad_read() only returns coordinates
  *     - No lv_event_send or lv_scr_load in touch handler
- *     - Navigation via ui_event flags
+ *     - Navigation via the lock-free UI event queue
  *
  *  ✅ FIX 5: No Blocking Code in Navigation
  *     - SD reads deferred/preloaded